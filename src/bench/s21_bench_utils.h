@@ -0,0 +1,55 @@
+#ifndef S21_BENCH_UTILS_H
+#define S21_BENCH_UTILS_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace s21_bench {
+
+// Sizes shared by every container benchmark: 1K, 16K, 256K elements
+constexpr int64_t kMinSize = 1 << 10;
+constexpr int64_t kMaxSize = 1 << 18;
+constexpr int kSizeMultiplier = 16;
+
+inline void Sizes(benchmark::internal::Benchmark* bench) {
+  bench->RangeMultiplier(kSizeMultiplier)->Range(kMinSize, kMaxSize);
+}
+
+// Keys of the two families we care about: machine words and strings long
+// enough to defeat the small-string optimization.
+template <class Key>
+Key MakeKey(std::size_t index);
+
+template <>
+inline int MakeKey<int>(std::size_t index) {
+  return static_cast<int>(index);
+}
+
+template <>
+inline std::string MakeKey<std::string>(std::size_t index) {
+  std::string digits = std::to_string(index);
+  return std::string("benchmark:key:") + std::string(12 - digits.size(), '0') +
+         digits;
+}
+
+// Keys 0..count-1 in a fixed pseudo-random order
+template <class Key>
+std::vector<Key> ShuffledKeys(std::size_t count, unsigned seed = 42) {
+  std::vector<std::size_t> order(count);
+  for (std::size_t i = 0; i < count; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937(seed));
+  std::vector<Key> keys;
+  keys.reserve(count);
+  for (std::size_t index : order) keys.push_back(MakeKey<Key>(index));
+  return keys;
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_BENCH_UTILS_H
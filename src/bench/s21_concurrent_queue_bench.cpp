@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_queue.h"
+
+namespace {
+
+constexpr int kItems = 1 << 20;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 32;
+
+// The baseline: a std::queue behind one mutex, bounded like the ring
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<int> queue_;
+  std::size_t capacity_;
+};
+
+struct OneByOne {
+  template <class Queue>
+  static int push(Queue& queue, const int* values, int /*count*/) {
+    return queue.try_push(values[0]) ? 1 : 0;
+  }
+  template <class Queue>
+  static int pop(Queue& queue, int* out) {
+    return queue.try_pop(out[0]) ? 1 : 0;
+  }
+};
+
+struct Batched {
+  template <class Queue>
+  static int push(Queue& queue, const int* values, int count) {
+    return static_cast<int>(queue.push_many(values, values + count));
+  }
+  template <class Queue>
+  static int pop(Queue& queue, int* out) {
+    return static_cast<int>(queue.pop_many(out, kBatch));
+  }
+};
+
+// Moves kItems through the queue with range(0) producers and range(1)
+// consumers; every iteration starts the threads afresh
+template <class Queue, class Mode>
+void BM_ProducersConsumers(benchmark::State& state) {
+  const int producers = static_cast<int>(state.range(0));
+  const int consumers = static_cast<int>(state.range(1));
+  const int per_producer = kItems / producers;
+  for (auto _ : state) {
+    Queue queue(kCapacity);
+    std::atomic<int> consumed{0};
+    const int total = per_producer * producers;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+      threads.emplace_back([&queue, per_producer] {
+        int values[kBatch];
+        for (int i = 0; i < per_producer;) {
+          int count = std::min<int>(kBatch, per_producer - i);
+          for (int k = 0; k < count; ++k) values[k] = i + k;
+          int pushed = Mode::push(queue, values, count);
+          // Full: let the consumers run (matters when cores are scarce)
+          if (pushed == 0) std::this_thread::yield();
+          i += pushed;
+        }
+      });
+    }
+    for (int c = 0; c < consumers; ++c) {
+      threads.emplace_back([&queue, &consumed, total] {
+        int out[kBatch];
+        long long sum = 0;
+        while (consumed.load(std::memory_order_relaxed) < total) {
+          int count = Mode::pop(queue, out);
+          for (int k = 0; k < count; ++k) sum += out[k];
+          if (count == 0) {
+            std::this_thread::yield();
+          } else {
+            consumed.fetch_add(count, std::memory_order_relaxed);
+          }
+        }
+        benchmark::DoNotOptimize(sum);
+      });
+    }
+    for (auto& thread : threads) thread.join();
+  }
+  state.SetItemsProcessed(state.iterations() * per_producer * producers);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, LockedQueue, OneByOne)
+    ->Args({1, 1})
+    ->Args({2, 2})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, s21::SpscQueue<int>, OneByOne)
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, s21::SpscQueue<int>, Batched)
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, s21::MpmcQueue<int>, OneByOne)
+    ->Args({1, 1})
+    ->Args({2, 2})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, s21::MpmcQueue<int>, Batched)
+    ->Args({1, 1})
+    ->Args({2, 2})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
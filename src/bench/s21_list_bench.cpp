@@ -0,0 +1,189 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <string>
+
+#include "../s21_list.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+template <class ListType>
+static ListType BuildList(
+    const std::vector<typename ListType::value_type>& values) {
+  ListType list;
+  for (const auto& value : values) {
+    list.push_back(value);
+  }
+  return list;
+}
+
+template <class ListType>
+static void BM_ListPushBack(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  for (auto _ : state) {
+    ListType list = BuildList<ListType>(values);
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Inserts before every element, doubling the list
+template <class ListType>
+static void BM_ListInsert(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = BuildList<ListType>(values);
+    state.ResumeTiming();
+    auto value = values.begin();
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      list.insert(it, *value++);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListErase(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = BuildList<ListType>(values);
+    state.ResumeTiming();
+    while (!list.empty()) {
+      list.erase(list.begin());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Linear search for a missing value
+template <class ListType>
+static void BM_ListLookup(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  ListType list = BuildList<ListType>(values);
+  const auto missing = s21_bench::MakeKey<typename ListType::value_type>(
+      state.range(0) + 1);
+  for (auto _ : state) {
+    bool found = false;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+      if (*it == missing) found = true;
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListIterate(benchmark::State& state) {
+  ListType list = BuildList<ListType>(
+      ShuffledKeys<typename ListType::value_type>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+      benchmark::DoNotOptimize(*it);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListCopy(benchmark::State& state) {
+  ListType list = BuildList<ListType>(
+      ShuffledKeys<typename ListType::value_type>(state.range(0)));
+  for (auto _ : state) {
+    ListType copy(list);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class ListType>
+static void BM_ListSort(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType list = BuildList<ListType>(values);
+    state.ResumeTiming();
+    list.sort();
+    benchmark::DoNotOptimize(list.size());
+    state.PauseTiming();
+    list.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Merge of two sorted halves
+template <class ListType>
+static void BM_ListMerge(benchmark::State& state) {
+  auto values = ShuffledKeys<typename ListType::value_type>(state.range(0));
+  auto middle = values.begin() + values.size() / 2;
+  ListType left = BuildList<ListType>({values.begin(), middle});
+  ListType right = BuildList<ListType>({middle, values.end()});
+  left.sort();
+  right.sort();
+  for (auto _ : state) {
+    state.PauseTiming();
+    ListType target(left);
+    ListType source(right);
+    state.ResumeTiming();
+    target.merge(source);
+    benchmark::DoNotOptimize(target.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_LIST_BENCHMARKS(...)                                          \
+  BENCHMARK_TEMPLATE(BM_ListPushBack, __VA_ARGS__)                        \
+      ->Apply(s21_bench::Sizes);                                          \
+  BENCHMARK_TEMPLATE(BM_ListInsert, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_ListErase, __VA_ARGS__)->Apply(s21_bench::Sizes);  \
+  BENCHMARK_TEMPLATE(BM_ListLookup, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_ListIterate, __VA_ARGS__)                         \
+      ->Apply(s21_bench::Sizes);                                          \
+  BENCHMARK_TEMPLATE(BM_ListCopy, __VA_ARGS__)->Apply(s21_bench::Sizes);   \
+  BENCHMARK_TEMPLATE(BM_ListSort, __VA_ARGS__)->Apply(s21_bench::Sizes);   \
+  BENCHMARK_TEMPLATE(BM_ListMerge, __VA_ARGS__)->Apply(s21_bench::Sizes)
+
+S21_LIST_BENCHMARKS(s21::List<int>);
+S21_LIST_BENCHMARKS(s21::PooledList<int>);
+S21_LIST_BENCHMARKS(std::list<int>);
+S21_LIST_BENCHMARKS(s21::List<std::string>);
+S21_LIST_BENCHMARKS(std::list<std::string>);
+
+// Queue-like churn: fill, then drain from the front
+template <class ListType>
+static void BM_ListChurn(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  ListType list;
+  for (auto _ : state) {
+    for (int i = 0; i < count; ++i) {
+      list.push_back(i);
+    }
+    while (!list.empty()) {
+      list.pop_front();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["system_allocs"] = static_cast<double>(
+      list.get_allocator().stats().system_allocations);
+}
+BENCHMARK_TEMPLATE(BM_ListChurn, s21::List<int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_ListChurn, s21::PooledList<int>)->Arg(1000)->Arg(100000);
+
+// Large sorts against std::list::sort
+BENCHMARK_TEMPLATE(BM_ListSort, s21::List<int>)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ListSort, std::list<int>)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,230 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <string>
+
+#include "../s21_btree_map.h"
+#include "../s21_flat_map.h"
+#include "../s21_map.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+template <class MapType>
+static MapType BuildMap(const std::vector<typename MapType::key_type>& keys) {
+  MapType map;
+  int value = 0;
+  for (const auto& key : keys) {
+    map.insert(typename MapType::value_type(key, value++));
+  }
+  return map;
+}
+
+template <class MapType>
+static void BM_MapInsert(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  for (auto _ : state) {
+    MapType map = BuildMap<MapType>(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_MapFind(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  MapType map = BuildMap<MapType>(keys);
+  auto lookups = ShuffledKeys<typename MapType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    for (const auto& key : lookups) {
+      benchmark::DoNotOptimize(map.find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_MapErase(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  auto order = ShuffledKeys<typename MapType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    MapType map = BuildMap<MapType>(keys);
+    state.ResumeTiming();
+    for (const auto& key : order) {
+      map.erase(map.find(key));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_MapIterate(benchmark::State& state) {
+  MapType map = BuildMap<MapType>(
+      ShuffledKeys<typename MapType::key_type>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += it->second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_MapCopy(benchmark::State& state) {
+  MapType map = BuildMap<MapType>(
+      ShuffledKeys<typename MapType::key_type>(state.range(0)));
+  for (auto _ : state) {
+    MapType copy(map);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Two halves with disjoint keys merged into one map
+template <class MapType>
+static void BM_MapMerge(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  auto middle = keys.begin() + keys.size() / 2;
+  std::vector<typename MapType::key_type> left(keys.begin(), middle);
+  std::vector<typename MapType::key_type> right(middle, keys.end());
+  for (auto _ : state) {
+    state.PauseTiming();
+    MapType target = BuildMap<MapType>(left);
+    MapType source = BuildMap<MapType>(right);
+    state.ResumeTiming();
+    target.merge(source);
+    benchmark::DoNotOptimize(target.size());
+  }
+  state.SetItemsProcessed(state.iterations() * (state.range(0) / 2));
+}
+
+// Word-count pattern: operator[] on keys that are mostly present
+template <class MapType>
+static void BM_MapSubscript(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  MapType map = BuildMap<MapType>(keys);
+  auto lookups = ShuffledKeys<typename MapType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    for (const auto& key : lookups) {
+      ++map[key];
+    }
+  }
+  benchmark::DoNotOptimize(map.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_MAP_BENCHMARKS(...)                                            \
+  BENCHMARK_TEMPLATE(BM_MapInsert, __VA_ARGS__)->Apply(s21_bench::Sizes);  \
+  BENCHMARK_TEMPLATE(BM_MapSubscript, __VA_ARGS__)                         \
+      ->Apply(s21_bench::Sizes);                                           \
+  BENCHMARK_TEMPLATE(BM_MapFind, __VA_ARGS__)->Apply(s21_bench::Sizes);    \
+  BENCHMARK_TEMPLATE(BM_MapErase, __VA_ARGS__)->Apply(s21_bench::Sizes);   \
+  BENCHMARK_TEMPLATE(BM_MapIterate, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_MapCopy, __VA_ARGS__)->Apply(s21_bench::Sizes);    \
+  BENCHMARK_TEMPLATE(BM_MapMerge, __VA_ARGS__)->Apply(s21_bench::Sizes)
+
+S21_MAP_BENCHMARKS(s21::Map<int, int>);
+S21_MAP_BENCHMARKS(s21::BTreeMap<int, int>);
+S21_MAP_BENCHMARKS(std::map<int, int>);
+S21_MAP_BENCHMARKS(s21::Map<std::string, int>);
+S21_MAP_BENCHMARKS(s21::BTreeMap<std::string, int>);
+S21_MAP_BENCHMARKS(std::map<std::string, int>);
+
+// Lookups in a map far larger than the caches
+BENCHMARK_TEMPLATE(BM_MapFind, s21::Map<int, int>)
+    ->Arg(1 << 23)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MapFind, s21::BTreeMap<int, int>)
+    ->Arg(1 << 23)
+    ->Unit(benchmark::kMillisecond);
+
+// Монотонно возрастающие ключи: худший случай для несбалансированного дерева
+static void BM_MapInsertSorted(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::Map<int, int> map;
+    for (int i = 0; i < count; ++i) {
+      map.insert(i, i);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_MapInsertSorted)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Загрузка тех же ключей одним проходом
+static void BM_MapFromSorted(benchmark::State& state) {
+  std::vector<std::pair<int, int>> items;
+  items.reserve(state.range(0));
+  for (int i = 0; i < state.range(0); ++i) items.emplace_back(i, i);
+  for (auto _ : state) {
+    auto map = s21::Map<int, int>::from_sorted(items.begin(), items.end());
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MapFromSorted)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// FlatMap is built in one batch: inserting shuffled keys one at a time
+// shifts half the array per insert, which is exactly what it is not for
+template <class Key>
+static s21::FlatMap<Key, int> BuildFlatMap(const std::vector<Key>& keys) {
+  std::vector<std::pair<Key, int>> items;
+  items.reserve(keys.size());
+  int value = 0;
+  for (const auto& key : keys) items.emplace_back(key, value++);
+  return s21::FlatMap<Key, int>(items.begin(), items.end());
+}
+
+template <class Key>
+static void BM_FlatMapBuild(benchmark::State& state) {
+  auto keys = ShuffledKeys<Key>(state.range(0));
+  for (auto _ : state) {
+    auto map = BuildFlatMap(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Key>
+static void BM_FlatMapFind(benchmark::State& state) {
+  auto map = BuildFlatMap(ShuffledKeys<Key>(state.range(0)));
+  auto lookups = ShuffledKeys<Key>(state.range(0), 7);
+  for (auto _ : state) {
+    for (const auto& key : lookups) {
+      benchmark::DoNotOptimize(map.find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Key>
+static void BM_FlatMapIterate(benchmark::State& state) {
+  auto map = BuildFlatMap(ShuffledKeys<Key>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += it->second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_FlatMapBuild, int)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapFind, int)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapIterate, int)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapBuild, std::string)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapFind, std::string)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapIterate, std::string)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_FlatMapFind, int)
+    ->Arg(1 << 23)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_memory_resource.h"
+#include "../s21_vector.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+// Where the containers of one "request" get their memory. end_request()
+// runs after the containers are gone.
+struct GlobalHeap {
+  s21::Map<int, int> make_map() { return {}; }
+  s21::List<int> make_list() { return {}; }
+  s21::Vector<int> make_vector() { return {}; }
+  void end_request() {}
+};
+
+// One arena per handler, rewound after every request
+struct Arena {
+  s21::ArenaResource arena;
+  s21::pmr::Map<int, int> make_map() { return s21::pmr::Map<int, int>(&arena); }
+  s21::pmr::List<int> make_list() { return s21::pmr::List<int>(&arena); }
+  s21::pmr::Vector<int> make_vector() {
+    return s21::pmr::Vector<int>(&arena);
+  }
+  void end_request() { arena.reset(); }
+};
+
+struct Pool {
+  s21::PoolResource pool;
+  s21::pmr::Map<int, int> make_map() { return s21::pmr::Map<int, int>(&pool); }
+  s21::pmr::List<int> make_list() { return s21::pmr::List<int>(&pool); }
+  s21::pmr::Vector<int> make_vector() { return s21::pmr::Vector<int>(&pool); }
+  void end_request() {}
+};
+
+// Builds a map, a list and a vector of range(0) elements and drops them,
+// the pattern of a request handler
+template <class Memory>
+static void BM_ShortLivedContainers(benchmark::State& state) {
+  auto keys = ShuffledKeys<int>(state.range(0));
+  Memory memory;
+  for (auto _ : state) {
+    {
+      auto map = memory.make_map();
+      auto list = memory.make_list();
+      auto vector = memory.make_vector();
+      for (int key : keys) {
+        map.insert(key, key);
+        list.push_back(key);
+        vector.push_back(key);
+      }
+      benchmark::DoNotOptimize(map.size() + list.size() + vector.size());
+    }
+    memory.end_request();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_SHORT_LIVED_BENCHMARK(Memory)                  \
+  BENCHMARK_TEMPLATE(BM_ShortLivedContainers, Memory)      \
+      ->RangeMultiplier(s21_bench::kSizeMultiplier)        \
+      ->Range(16, 4096)
+
+S21_SHORT_LIVED_BENCHMARK(GlobalHeap);
+S21_SHORT_LIVED_BENCHMARK(Arena);
+S21_SHORT_LIVED_BENCHMARK(Pool);
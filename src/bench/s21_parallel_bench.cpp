@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "../s21_parallel.h"
+#include "../s21_vector.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+// Large enough to leave the caches, small enough for a quick run
+constexpr int kParallelSize = 1 << 22;
+
+// Pool sizes 1, 2, 4, ... up to the cores of this machine, plus the
+// machine size itself when it is not a power of two
+static void ThreadCounts(benchmark::internal::Benchmark* bench) {
+  const int cores = static_cast<int>(s21::ThreadPool::default_threads());
+  for (int threads = 1; threads < cores; threads *= 2) bench->Arg(threads);
+  bench->Arg(cores);
+  bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+static s21::Vector<int> ShuffledVector() {
+  auto keys = ShuffledKeys<int>(kParallelSize);
+  s21::Vector<int> vec(keys.size());
+  std::copy(keys.begin(), keys.end(), vec.begin());
+  return vec;
+}
+
+static void BM_StdSort(benchmark::State& state) {
+  const s21::Vector<int> input = ShuffledVector();
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Vector<int> vec = input;
+    state.ResumeTiming();
+    std::sort(vec.begin(), vec.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_StdSort)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ParallelSort(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  const s21::Vector<int> input = ShuffledVector();
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Vector<int> vec = input;
+    state.ResumeTiming();
+    s21::parallel::sort(pool, vec.begin(), vec.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_ParallelSort)->Apply(ThreadCounts);
+
+static void BM_ParallelReduce(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  const s21::Vector<int> input = ShuffledVector();
+  for (auto _ : state) {
+    long long sum = s21::parallel::reduce(pool, input.begin(), input.end(), 0LL,
+                                          std::plus<>());
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_ParallelReduce)->Apply(ThreadCounts);
+
+static void BM_ParallelTransform(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  const s21::Vector<int> input = ShuffledVector();
+  s21::Vector<double> output(input.size());
+  for (auto _ : state) {
+    s21::parallel::transform(pool, input.begin(), input.end(), output.begin(),
+                             [](int x) { return std::sqrt(double(x)); });
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_ParallelTransform)->Apply(ThreadCounts);
+
+static void BM_ParallelInclusiveScan(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  const s21::Vector<int> input = ShuffledVector();
+  s21::Vector<long long> output(input.size());
+  for (auto _ : state) {
+    s21::parallel::inclusive_scan(pool, input.begin(), input.end(),
+                                  output.begin(), std::plus<long long>());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_ParallelInclusiveScan)->Apply(ThreadCounts);
+
+static void BM_ParallelPartition(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  const s21::Vector<int> input = ShuffledVector();
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::Vector<int> vec = input;
+    state.ResumeTiming();
+    auto middle = s21::parallel::partition(
+        pool, vec.begin(), vec.end(),
+        [](int x) { return x < kParallelSize / 2; });
+    benchmark::DoNotOptimize(middle);
+  }
+  state.SetItemsProcessed(state.iterations() * kParallelSize);
+}
+BENCHMARK(BM_ParallelPartition)->Apply(ThreadCounts);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../s21_priority_queue.h"
+#include "../s21_set.h"
+#include "s21_bench_utils.h"
+
+// The "hold" model of an event scheduler: range(0) events are pending, and
+// every step takes the earliest one and schedules a new event after it.
+
+struct SetScheduler {
+  s21::Set<double> events;
+  void push(double time) { events.insert(time); }
+  double pop() {
+    auto first = events.begin();
+    const double time = first->first;
+    events.erase(first);
+    return time;
+  }
+};
+
+template <std::size_t Arity>
+struct HeapScheduler {
+  s21::PriorityQueue<double, std::greater<double>, s21::Vector<double>, Arity>
+      events;
+  void push(double time) { events.push(time); }
+  double pop() {
+    const double time = events.top();
+    events.pop();
+    return time;
+  }
+};
+
+struct StdScheduler {
+  std::priority_queue<double, std::vector<double>, std::greater<double>>
+      events;
+  void push(double time) { events.push(time); }
+  double pop() {
+    const double time = events.top();
+    events.pop();
+    return time;
+  }
+};
+
+template <class Scheduler>
+static void BM_SchedulerHold(benchmark::State& state) {
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> delay(0.0, 1000.0);
+  Scheduler scheduler;
+  for (int64_t i = 0; i < state.range(0); ++i) scheduler.push(delay(rng));
+  for (auto _ : state) {
+    const double now = scheduler.pop();
+    scheduler.push(now + delay(rng));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_SchedulerHold, SetScheduler)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_SchedulerHold, StdScheduler)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_SchedulerHold, HeapScheduler<2>)
+    ->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_SchedulerHold, HeapScheduler<4>)
+    ->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_SchedulerHold, HeapScheduler<8>)
+    ->Apply(s21_bench::Sizes);
+
+// Bulk construction: O(n) heapify against n pushes
+template <bool Bulk>
+static void BM_PriorityQueueBuild(benchmark::State& state) {
+  auto keys = s21_bench::ShuffledKeys<int>(state.range(0));
+  for (auto _ : state) {
+    s21::PriorityQueue<int> queue;
+    if (Bulk) {
+      queue.push_many(keys.begin(), keys.end());
+    } else {
+      for (int key : keys) queue.push(key);
+    }
+    benchmark::DoNotOptimize(queue.top());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_PriorityQueueBuild, false)->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_PriorityQueueBuild, true)->Apply(s21_bench::Sizes);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <string>
+
+#include "../s21_queue.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+// Fill, then drain from the front
+template <class QueueType>
+static void BM_QueuePushPop(benchmark::State& state) {
+  auto values = ShuffledKeys<typename QueueType::value_type>(state.range(0));
+  QueueType queue;
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      queue.push(value);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.front());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class QueueType>
+static void BM_QueueCopy(benchmark::State& state) {
+  QueueType queue;
+  for (const auto& value :
+       ShuffledKeys<typename QueueType::value_type>(state.range(0))) {
+    queue.push(value);
+  }
+  for (auto _ : state) {
+    QueueType copy(queue);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Pipeline pattern: keep a window of items in flight
+template <class QueueType>
+static void BM_QueueWindow(benchmark::State& state) {
+  const int window = static_cast<int>(state.range(0));
+  QueueType queue;
+  for (int i = 0; i < window; ++i) {
+    queue.push(s21_bench::MakeKey<typename QueueType::value_type>(i));
+  }
+  const auto value = s21_bench::MakeKey<typename QueueType::value_type>(0);
+  for (auto _ : state) {
+    queue.push(value);
+    benchmark::DoNotOptimize(queue.front());
+    queue.pop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define S21_QUEUE_BENCHMARKS(...)                                         \
+  BENCHMARK_TEMPLATE(BM_QueuePushPop, __VA_ARGS__)                        \
+      ->Apply(s21_bench::Sizes);                                          \
+  BENCHMARK_TEMPLATE(BM_QueueCopy, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_QueueWindow, __VA_ARGS__)->Arg(16)->Arg(4096)
+
+S21_QUEUE_BENCHMARKS(s21::Queue<int>);
+S21_QUEUE_BENCHMARKS(s21::Queue<int, s21::List<int>>);
+S21_QUEUE_BENCHMARKS(std::queue<int>);
+S21_QUEUE_BENCHMARKS(s21::Queue<std::string>);
+S21_QUEUE_BENCHMARKS(std::queue<std::string>);
@@ -0,0 +1,176 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_set.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+template <class SetType>
+static SetType BuildSet(const std::vector<typename SetType::key_type>& keys) {
+  SetType set;
+  for (const auto& key : keys) {
+    set.insert(key);
+  }
+  return set;
+}
+
+template <class SetType>
+static void BM_SetInsert(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename SetType::key_type>(state.range(0));
+  for (auto _ : state) {
+    SetType set = BuildSet<SetType>(keys);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Membership checks, half of them misses
+template <class SetType>
+static void BM_SetContains(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename SetType::key_type>(state.range(0));
+  auto middle = keys.begin() + keys.size() / 2;
+  SetType set = BuildSet<SetType>({keys.begin(), middle});
+  for (auto _ : state) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(set.find(key) != set.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class SetType>
+static void BM_SetErase(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename SetType::key_type>(state.range(0));
+  auto order = ShuffledKeys<typename SetType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    SetType set = BuildSet<SetType>(keys);
+    state.ResumeTiming();
+    for (const auto& key : order) {
+      set.erase(set.find(key));
+    }
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class SetType>
+static void BM_SetIterate(benchmark::State& state) {
+  SetType set = BuildSet<SetType>(
+      ShuffledKeys<typename SetType::key_type>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (auto it = set.begin(); it != set.end(); ++it) {
+      benchmark::DoNotOptimize(&*it);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class SetType>
+static void BM_SetCopy(benchmark::State& state) {
+  SetType set = BuildSet<SetType>(
+      ShuffledKeys<typename SetType::key_type>(state.range(0)));
+  for (auto _ : state) {
+    SetType copy(set);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class SetType>
+static void BM_SetMerge(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename SetType::key_type>(state.range(0));
+  auto middle = keys.begin() + keys.size() / 2;
+  std::vector<typename SetType::key_type> left(keys.begin(), middle);
+  std::vector<typename SetType::key_type> right(middle, keys.end());
+  for (auto _ : state) {
+    state.PauseTiming();
+    SetType target = BuildSet<SetType>(left);
+    SetType source = BuildSet<SetType>(right);
+    state.ResumeTiming();
+    target.merge(source);
+    benchmark::DoNotOptimize(target.size());
+  }
+  state.SetItemsProcessed(state.iterations() * (state.range(0) / 2));
+}
+
+#define S21_SET_BENCHMARKS(...)                                            \
+  BENCHMARK_TEMPLATE(BM_SetInsert, __VA_ARGS__)->Apply(s21_bench::Sizes);  \
+  BENCHMARK_TEMPLATE(BM_SetContains, __VA_ARGS__)                          \
+      ->Apply(s21_bench::Sizes);                                           \
+  BENCHMARK_TEMPLATE(BM_SetErase, __VA_ARGS__)->Apply(s21_bench::Sizes);   \
+  BENCHMARK_TEMPLATE(BM_SetIterate, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_SetCopy, __VA_ARGS__)->Apply(s21_bench::Sizes);    \
+  BENCHMARK_TEMPLATE(BM_SetMerge, __VA_ARGS__)->Apply(s21_bench::Sizes)
+
+S21_SET_BENCHMARKS(s21::Set<int>);
+S21_SET_BENCHMARKS(std::set<int>);
+S21_SET_BENCHMARKS(s21::Set<std::string>);
+S21_SET_BENCHMARKS(std::set<std::string>);
+
+// Tag-set intersection: a set of range(0) keys against one range(1) times
+// smaller, half of whose keys are shared
+static void SkewedPair(int64_t size, int64_t ratio, std::vector<int>& large,
+                       std::vector<int>& small) {
+  large = ShuffledKeys<int>(size);
+  small.clear();
+  for (int64_t k = 0; k < size / ratio; ++k) {
+    small.push_back(k % 2 ? large[k] : -static_cast<int>(k) - 1);
+  }
+}
+
+static void SetIntersectionArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t ratio : {1, 16, 1024}) bench->Args({1 << 18, ratio});
+}
+
+static void BM_SetIntersection(benchmark::State& state) {
+  std::vector<int> large_keys;
+  std::vector<int> small_keys;
+  SkewedPair(state.range(0), state.range(1), large_keys, small_keys);
+  auto large = BuildSet<s21::Set<int>>(large_keys);
+  auto small = BuildSet<s21::Set<int>>(small_keys);
+  for (auto _ : state) {
+    s21::Set<int> result = large.set_intersection(small);
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+BENCHMARK(BM_SetIntersection)->Apply(SetIntersectionArgs);
+
+// The same through std::set_intersection with a hinted inserter
+static void BM_StdSetIntersection(benchmark::State& state) {
+  std::vector<int> large_keys;
+  std::vector<int> small_keys;
+  SkewedPair(state.range(0), state.range(1), large_keys, small_keys);
+  std::set<int> large(large_keys.begin(), large_keys.end());
+  std::set<int> small(small_keys.begin(), small_keys.end());
+  for (auto _ : state) {
+    std::set<int> result;
+    std::set_intersection(large.begin(), large.end(), small.begin(),
+                          small.end(),
+                          std::inserter(result, result.end()));
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+BENCHMARK(BM_StdSetIntersection)->Apply(SetIntersectionArgs);
+
+static void BM_SetUnion(benchmark::State& state) {
+  std::vector<int> large_keys;
+  std::vector<int> small_keys;
+  SkewedPair(state.range(0), state.range(1), large_keys, small_keys);
+  auto large = BuildSet<s21::Set<int>>(large_keys);
+  auto small = BuildSet<s21::Set<int>>(small_keys);
+  for (auto _ : state) {
+    s21::Set<int> result = large.set_union(small);
+    benchmark::DoNotOptimize(result.size());
+  }
+}
+BENCHMARK(BM_SetUnion)->Args({1 << 18, 1});
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <stack>
+#include <string>
+
+#include "../s21_stack.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+// DFS-like pattern: grow to a depth, then unwind
+template <class StackType>
+static void BM_StackPushPop(benchmark::State& state) {
+  auto values = ShuffledKeys<typename StackType::value_type>(state.range(0));
+  StackType stack;
+  for (auto _ : state) {
+    for (const auto& value : values) {
+      stack.push(value);
+    }
+    while (!stack.empty()) {
+      benchmark::DoNotOptimize(stack.top());
+      stack.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class StackType>
+static void BM_StackCopy(benchmark::State& state) {
+  StackType stack;
+  for (const auto& value :
+       ShuffledKeys<typename StackType::value_type>(state.range(0))) {
+    stack.push(value);
+  }
+  for (auto _ : state) {
+    StackType copy(stack);
+    benchmark::DoNotOptimize(copy.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_STACK_BENCHMARKS(...)                  \
+  BENCHMARK_TEMPLATE(BM_StackPushPop, __VA_ARGS__) \
+      ->Apply(s21_bench::Sizes);                   \
+  BENCHMARK_TEMPLATE(BM_StackCopy, __VA_ARGS__)->Apply(s21_bench::Sizes)
+
+S21_STACK_BENCHMARKS(s21::Stack<int>);
+S21_STACK_BENCHMARKS(s21::Stack<int, s21::List<int>>);
+S21_STACK_BENCHMARKS(std::stack<int>);
+S21_STACK_BENCHMARKS(s21::Stack<std::string>);
+S21_STACK_BENCHMARKS(std::stack<std::string>);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+template <class MapType>
+static MapType BuildHashMap(
+    const std::vector<typename MapType::key_type>& keys) {
+  MapType map;
+  int value = 0;
+  for (const auto& key : keys) {
+    map.insert(typename MapType::value_type(key, value++));
+  }
+  return map;
+}
+
+template <class MapType>
+static void BM_HashMapInsert(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  for (auto _ : state) {
+    MapType map = BuildHashMap<MapType>(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Successful lookups
+template <class MapType>
+static void BM_HashMapFindHit(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  MapType map = BuildHashMap<MapType>(keys);
+  auto lookups = ShuffledKeys<typename MapType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    for (const auto& key : lookups) {
+      benchmark::DoNotOptimize(map.find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Lookups of keys that are absent
+template <class MapType>
+static void BM_HashMapFindMiss(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0) * 2);
+  auto middle = keys.begin() + keys.size() / 2;
+  MapType map = BuildHashMap<MapType>({keys.begin(), middle});
+  std::vector<typename MapType::key_type> lookups(middle, keys.end());
+  for (auto _ : state) {
+    for (const auto& key : lookups) {
+      benchmark::DoNotOptimize(map.find(key) == map.end());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_HashMapErase(benchmark::State& state) {
+  auto keys = ShuffledKeys<typename MapType::key_type>(state.range(0));
+  auto order = ShuffledKeys<typename MapType::key_type>(state.range(0), 7);
+  for (auto _ : state) {
+    state.PauseTiming();
+    MapType map = BuildHashMap<MapType>(keys);
+    state.ResumeTiming();
+    for (const auto& key : order) {
+      map.erase(map.find(key));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class MapType>
+static void BM_HashMapIterate(benchmark::State& state) {
+  MapType map = BuildHashMap<MapType>(
+      ShuffledKeys<typename MapType::key_type>(state.range(0)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += it->second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_HASH_MAP_BENCHMARKS(...)                   \
+  BENCHMARK_TEMPLATE(BM_HashMapInsert, __VA_ARGS__)    \
+      ->Apply(s21_bench::Sizes);                       \
+  BENCHMARK_TEMPLATE(BM_HashMapFindHit, __VA_ARGS__)   \
+      ->Apply(s21_bench::Sizes);                       \
+  BENCHMARK_TEMPLATE(BM_HashMapFindMiss, __VA_ARGS__)  \
+      ->Apply(s21_bench::Sizes);                       \
+  BENCHMARK_TEMPLATE(BM_HashMapErase, __VA_ARGS__)     \
+      ->Apply(s21_bench::Sizes);                       \
+  BENCHMARK_TEMPLATE(BM_HashMapIterate, __VA_ARGS__)   \
+      ->Apply(s21_bench::Sizes)
+
+S21_HASH_MAP_BENCHMARKS(s21::UnorderedMap<int, int>);
+S21_HASH_MAP_BENCHMARKS(std::unordered_map<int, int>);
+S21_HASH_MAP_BENCHMARKS(s21::Map<int, int>);
+S21_HASH_MAP_BENCHMARKS(s21::UnorderedMap<std::string, int>);
+S21_HASH_MAP_BENCHMARKS(std::unordered_map<std::string, int>);
+S21_HASH_MAP_BENCHMARKS(s21::Map<std::string, int>);
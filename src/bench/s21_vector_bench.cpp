@@ -0,0 +1,335 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_incremental_vector.h"
+#include "../s21_mapped_vector.h"
+#include "../s21_small_vector.h"
+#include "../s21_vector.h"
+#include "s21_bench_utils.h"
+
+using s21_bench::ShuffledKeys;
+
+// Number of single-element inserts/erases per iteration; they shift the
+// tail, so doing n of them would be quadratic.
+constexpr int kShiftOps = 256;
+
+template <class VectorType>
+static VectorType BuildVector(
+    const std::vector<typename VectorType::value_type>& values) {
+  VectorType vec;
+  for (const auto& value : values) {
+    vec.push_back(value);
+  }
+  return vec;
+}
+
+static std::size_t Weight(int value) { return static_cast<std::size_t>(value); }
+static std::size_t Weight(const std::string& value) { return value.size(); }
+
+template <class VectorType>
+static void BM_VectorPushBack(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  for (auto _ : state) {
+    VectorType vec = BuildVector<VectorType>(values);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class VectorType>
+static void BM_VectorInsertMiddle(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vec = BuildVector<VectorType>(values);
+    state.ResumeTiming();
+    for (int i = 0; i < kShiftOps; ++i) {
+      vec.insert(vec.begin() + vec.size() / 2, values[i]);
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kShiftOps);
+}
+
+template <class VectorType>
+static void BM_VectorEraseFront(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vec = BuildVector<VectorType>(values);
+    state.ResumeTiming();
+    for (int i = 0; i < kShiftOps; ++i) {
+      vec.erase(vec.begin());
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kShiftOps);
+}
+
+// Random-index reads
+template <class VectorType>
+static void BM_VectorLookup(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  VectorType vec = BuildVector<VectorType>(values);
+  auto indices = ShuffledKeys<int>(state.range(0), 7);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (int index : indices) sum += Weight(vec[index]);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class VectorType>
+static void BM_VectorIterate(benchmark::State& state) {
+  VectorType vec = BuildVector<VectorType>(
+      ShuffledKeys<typename VectorType::value_type>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (auto it = vec.begin(); it != vec.end(); ++it) sum += Weight(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class VectorType>
+static void BM_VectorCopy(benchmark::State& state) {
+  VectorType vec = BuildVector<VectorType>(
+      ShuffledKeys<typename VectorType::value_type>(state.range(0)));
+  for (auto _ : state) {
+    VectorType copy(vec);
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class VectorType>
+static void BM_VectorSort(benchmark::State& state) {
+  VectorType vec = BuildVector<VectorType>(
+      ShuffledKeys<typename VectorType::value_type>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType copy(vec);
+    state.ResumeTiming();
+    std::sort(copy.begin(), copy.end());
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_VECTOR_BENCHMARKS(...)                                      \
+  BENCHMARK_TEMPLATE(BM_VectorPushBack, __VA_ARGS__)                    \
+      ->Apply(s21_bench::Sizes);                                        \
+  BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, __VA_ARGS__)                \
+      ->Apply(s21_bench::Sizes);                                        \
+  BENCHMARK_TEMPLATE(BM_VectorEraseFront, __VA_ARGS__)                  \
+      ->Apply(s21_bench::Sizes);                                        \
+  BENCHMARK_TEMPLATE(BM_VectorLookup, __VA_ARGS__)                      \
+      ->Apply(s21_bench::Sizes);                                        \
+  BENCHMARK_TEMPLATE(BM_VectorIterate, __VA_ARGS__)                     \
+      ->Apply(s21_bench::Sizes);                                        \
+  BENCHMARK_TEMPLATE(BM_VectorCopy, __VA_ARGS__)->Apply(s21_bench::Sizes); \
+  BENCHMARK_TEMPLATE(BM_VectorSort, __VA_ARGS__)->Apply(s21_bench::Sizes)
+
+S21_VECTOR_BENCHMARKS(s21::Vector<int>);
+S21_VECTOR_BENCHMARKS(std::vector<int>);
+S21_VECTOR_BENCHMARKS(s21::Vector<std::string>);
+S21_VECTOR_BENCHMARKS(std::vector<std::string>);
+
+static void BM_VectorReserveString(benchmark::State& state) {
+  for (auto _ : state) {
+    s21::Vector<std::string> vec;
+    vec.reserve(state.range(0));
+    benchmark::DoNotOptimize(vec.data());
+  }
+}
+BENCHMARK(BM_VectorReserveString)->Arg(1 << 24)->Unit(benchmark::kMicrosecond);
+
+// Per-request scratch array: a handful of elements filled and dropped
+// range(0) times, so the cost is dominated by the first allocations
+template <class VectorType>
+static void BM_VectorScratch(benchmark::State& state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    VectorType scratch;
+    for (int i = 0; i < count; ++i) scratch.push_back(i);
+    benchmark::DoNotOptimize(scratch.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+static void ScratchSizes(benchmark::internal::Benchmark* bench) {
+  for (int count : {1, 4, 7, 16}) bench->Arg(count);
+}
+BENCHMARK_TEMPLATE(BM_VectorScratch, s21::Vector<int>)->Apply(ScratchSizes);
+BENCHMARK_TEMPLATE(BM_VectorScratch, s21::SmallVector<int, 8>)
+    ->Apply(ScratchSizes);
+BENCHMARK_TEMPLATE(BM_VectorScratch, std::vector<int>)->Apply(ScratchSizes);
+
+// Tail latency of single push_back calls while a vector grows to range(0)
+// elements: p50, p99.9 and the worst call in nanoseconds. With doubling
+// the worst call copies the whole vector; IncrementalVector spreads that
+// copy over the following calls.
+template <class VectorType>
+static void BM_VectorPushBackLatency(benchmark::State& state) {
+  using Clock = std::chrono::steady_clock;
+  const std::size_t count = state.range(0);
+  std::vector<int64_t> latencies(count);
+  for (auto _ : state) {
+    VectorType vec;
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto start = Clock::now();
+      vec.push_back(static_cast<int>(i));
+      latencies[i] = (Clock::now() - start).count();
+    }
+    benchmark::DoNotOptimize(vec.size());
+  }
+  auto percentile = [&latencies](double fraction) {
+    auto nth = latencies.begin() + (latencies.size() - 1) * fraction;
+    std::nth_element(latencies.begin(), nth, latencies.end());
+    return static_cast<double>(*nth);
+  };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99.9_ns"] = percentile(0.999);
+  state.counters["max_ns"] = percentile(1.0);
+}
+BENCHMARK_TEMPLATE(BM_VectorPushBackLatency, s21::Vector<int>)
+    ->Arg(1 << 24)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_VectorPushBackLatency,
+                   s21::Vector<int, std::allocator<int>, s21::GrowOneAndHalf>)
+    ->Arg(1 << 24)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_VectorPushBackLatency, s21::IncrementalVector<int>)
+    ->Arg(1 << 24)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_VectorPushBackLatency, std::vector<int>)
+    ->Arg(1 << 24)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+// kShiftOps elements inserted into the middle as one range: compare with
+// BM_VectorInsertMiddle, which shifts the tail once per element
+template <class VectorType>
+static void BM_VectorInsertRangeMiddle(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vec = BuildVector<VectorType>(values);
+    state.ResumeTiming();
+    vec.insert(vec.begin() + vec.size() / 2, values.begin(),
+               values.begin() + kShiftOps);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kShiftOps);
+}
+
+template <class T, class Pred>
+static void EraseIf(s21::Vector<T>& vec, Pred pred) {
+  s21::erase_if(vec, pred);
+}
+template <class T, class Pred>
+static void EraseIf(std::vector<T>& vec, Pred pred) {
+  vec.erase(std::remove_if(vec.begin(), vec.end(), pred), vec.end());
+}
+
+// Log compaction: drop every record whose weight is odd
+template <class VectorType>
+static void BM_VectorEraseIf(benchmark::State& state) {
+  auto values = ShuffledKeys<typename VectorType::value_type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    VectorType vec = BuildVector<VectorType>(values);
+    state.ResumeTiming();
+    EraseIf(vec, [](const auto& value) { return Weight(value) % 2 != 0; });
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define S21_VECTOR_RANGE_BENCHMARKS(...)                             \
+  BENCHMARK_TEMPLATE(BM_VectorInsertRangeMiddle, __VA_ARGS__)        \
+      ->Apply(s21_bench::Sizes);                                     \
+  BENCHMARK_TEMPLATE(BM_VectorEraseIf, __VA_ARGS__)->Arg(1 << 22)    \
+      ->Unit(benchmark::kMillisecond)
+
+S21_VECTOR_RANGE_BENCHMARKS(s21::Vector<int>);
+S21_VECTOR_RANGE_BENCHMARKS(std::vector<int>);
+S21_VECTOR_RANGE_BENCHMARKS(s21::Vector<std::string>);
+S21_VECTOR_RANGE_BENCHMARKS(std::vector<std::string>);
+
+// Long strings moved in: move-aware push_back hands over the buffer,
+// a copying one allocates a new string per element
+template <class VectorType>
+static void BM_VectorPushBackMoved(benchmark::State& state) {
+  const std::string prototype(64, 'x');
+  for (auto _ : state) {
+    VectorType vec;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      std::string value(prototype);
+      vec.push_back(std::move(value));
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorPushBackMoved, s21::Vector<std::string>)
+    ->Apply(s21_bench::Sizes);
+BENCHMARK_TEMPLATE(BM_VectorPushBackMoved, std::vector<std::string>)
+    ->Apply(s21_bench::Sizes);
+
+static const char kMappedBenchFile[] = "s21_mapped_vector_bench.bin";
+
+// Appends through ftruncate + mremap growth; the file is rewritten from
+// scratch in every iteration
+static void BM_MappedVectorPushBack(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::remove(kMappedBenchFile);
+    state.ResumeTiming();
+    s21::MappedVector<int64_t> vec(kMappedBenchFile);
+    for (int64_t i = 0; i < state.range(0); ++i) vec.push_back(i);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  std::remove(kMappedBenchFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MappedVectorPushBack)
+    ->Arg(1 << 20)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
+
+// Reopens the file and sums it under the hint in range(1); with a warm
+// page cache this measures mapping and page-table cost rather than disk
+static void BM_MappedVectorScan(benchmark::State& state) {
+  std::remove(kMappedBenchFile);
+  {
+    s21::MappedVector<int64_t> vec(kMappedBenchFile);
+    vec.resize(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) vec[i] = i;
+  }
+  const auto pattern = static_cast<s21::AccessPattern>(state.range(1));
+  for (auto _ : state) {
+    s21::MappedVector<int64_t> vec(kMappedBenchFile);
+    vec.advise(pattern);
+    int64_t sum = 0;
+    for (int64_t value : vec) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(kMappedBenchFile);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MappedVectorScan)
+    ->Args({1 << 24, static_cast<int>(s21::AccessPattern::kNormal)})
+    ->Args({1 << 24, static_cast<int>(s21::AccessPattern::kSequential)})
+    ->Args({1 << 24, static_cast<int>(s21::AccessPattern::kRandom)})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,856 @@
+#ifndef S21_BTREE_H_
+#define S21_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// B-tree with wide nodes, shared by BTreeMap and BTreeSet.
+//
+// Every node keeps up to kSlots values sorted by key in one contiguous
+// array sized to roughly kNodeBytes, so a lookup touches a handful of
+// nodes instead of one cache line per level as in a binary tree. Internal
+// nodes additionally hold kSlots + 1 child pointers. Values live in both
+// leaf and internal nodes; every leaf is at the same depth.
+//
+// Keys are compared with operator< only, like in s21::Map.
+template <typename Value, typename Key, typename KeyOf>
+class BTree {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+
+  template <typename Item>
+  class BTreeIterator;
+  using iterator = BTreeIterator<Value>;
+  using const_iterator = BTreeIterator<const Value>;
+
+  BTree();
+  BTree(const BTree& other);
+  BTree(BTree&& other) noexcept;
+  ~BTree();
+
+  BTree& operator=(const BTree& other);
+  BTree& operator=(BTree&& other) noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  // Constructs a Value from args only if key is not present yet; the tree
+  // is descended once either way.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(const Key& key, Args&&... args);
+  // Takes over the values of other whose keys are missing here; the rest
+  // stay in other. Strong guarantee when moving a value cannot throw.
+  void merge_unique(BTree& other);
+  void erase(const_iterator pos);
+  size_type erase(const Key& key);
+  void swap(BTree& other) noexcept;
+
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+
+ private:
+  // Node size the slot count is derived from; 256 bytes is four cache
+  // lines, internal nodes are about twice as large with their children.
+  static constexpr size_type kNodeBytes = 256;
+  static constexpr size_type kHeaderBytes = 2 * sizeof(void*);
+  static constexpr size_type kSlots = std::min<size_type>(
+      255, std::max<size_type>(3, (kNodeBytes - kHeaderBytes) / sizeof(Value)));
+  // Each half of a split node keeps at least this many values; any node
+  // other than the root is rebalanced once it holds fewer
+  static constexpr size_type kMinSlots = (kSlots - 1) / 2;
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<Value>::value;
+
+  struct Node {
+    Node* parent;
+    std::uint8_t position;  // Index of this node among parent's children
+    std::uint8_t count;
+    bool leaf;
+    alignas(Value) unsigned char storage[kSlots * sizeof(Value)];
+
+    Value* slot(size_type i) {
+      return std::launder(reinterpret_cast<Value*>(storage)) + i;
+    }
+    const Value* slot(size_type i) const {
+      return std::launder(reinterpret_cast<const Value*>(storage)) + i;
+    }
+  };
+
+  struct InternalNode : Node {
+    Node* children[kSlots + 1];
+  };
+
+  Node* root_;
+  size_type size_;
+
+  static const Key& key_of(const Node* node, size_type i) {
+    return KeyOf()(*node->slot(i));
+  }
+  static Node* child(const Node* node, size_type i) {
+    return static_cast<const InternalNode*>(node)->children[i];
+  }
+  static void set_child(Node* node, size_type i, Node* value) {
+    static_cast<InternalNode*>(node)->children[i] = value;
+    value->parent = node;
+    value->position = static_cast<std::uint8_t>(i);
+  }
+  static Node* leftmost(Node* node) {
+    while (!node->leaf) node = child(node, 0);
+    return node;
+  }
+
+  static size_type lower_index(const Node* node, const Key& key);
+  static size_type upper_index(const Node* node, const Key& key);
+
+  static Node* new_node(Node* parent, bool leaf);
+  static void delete_node(Node* node);
+  static void destroy(Node* node);
+  static Node* clone(const Node* node, Node* parent);
+
+  template <typename K, typename M>
+  static std::pair<K&&, M&&> move_out(std::pair<const K, M>& value) {
+    return {std::move(const_cast<K&>(value.first)), std::move(value.second)};
+  }
+  template <typename V>
+  static V&& move_out(V& value) {
+    return std::move(value);
+  }
+  static void relocate(Value* dst, Value* src);
+  static void shift_right(Node* node, size_type from);
+  static void shift_left(Node* node, size_type from);
+  static void transfer(Node* dst, size_type dst_index, Node* src,
+                       size_type src_index, size_type count);
+
+  void split(Node* node);
+  void rebalance(Node* node);
+  void borrow_from_left(Node* left, Node* node);
+  void borrow_from_right(Node* node, Node* right);
+  void merge_nodes(Node* left, Node* right);
+  Node* find_node(const Key& key, size_type& index) const;
+  Node* lower_bound_node(const Key& key, size_type& index) const;
+  Node* upper_bound_node(const Key& key, size_type& index) const;
+};
+
+// In-order iterator: a node and a slot index; end() has a null node
+template <typename Value, typename Key, typename KeyOf>
+template <typename Item>
+class BTree<Value, Key, KeyOf>::BTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename BTree::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Item*;
+  using reference = Item&;
+
+  BTreeIterator(Node* node = nullptr, size_type position = 0)
+      : node_(node), position_(position) {}
+  // iterator converts to const_iterator
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same<const Other, Item>::value &&
+                                !std::is_same<Other, Item>::value>>
+  BTreeIterator(const BTreeIterator<Other>& other)
+      : node_(other.node_), position_(other.position_) {}
+
+  reference operator*() const { return *node_->slot(position_); }
+  pointer operator->() const { return node_->slot(position_); }
+
+  BTreeIterator& operator++() {
+    if (!node_->leaf) {
+      node_ = leftmost(child(node_, position_ + 1));
+      position_ = 0;
+      return *this;
+    }
+    ++position_;
+    while (position_ == node_->count) {
+      if (!node_->parent) {
+        node_ = nullptr;
+        position_ = 0;
+        break;
+      }
+      position_ = node_->position;
+      node_ = node_->parent;
+    }
+    return *this;
+  }
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+  BTreeIterator& operator--() {
+    if (!node_->leaf) {
+      node_ = child(node_, position_);
+      while (!node_->leaf) node_ = child(node_, node_->count);
+      position_ = node_->count - 1;
+      return *this;
+    }
+    while (position_ == 0 && node_->parent) {
+      position_ = node_->position;
+      node_ = node_->parent;
+    }
+    --position_;
+    return *this;
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  bool operator==(const BTreeIterator& other) const {
+    return node_ == other.node_ && position_ == other.position_;
+  }
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class BTree;
+  template <typename Other>
+  friend class BTreeIterator;
+
+  Node* node_;
+  size_type position_;
+};
+
+// Constructors and assignment
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>::BTree() : root_(nullptr), size_(0) {}
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>::BTree(const BTree& other)
+    : root_(clone(other.root_, nullptr)), size_(other.size_) {}
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>::BTree(BTree&& other) noexcept
+    : root_(other.root_), size_(other.size_) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>::~BTree() {
+  destroy(root_);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>& BTree<Value, Key, KeyOf>::operator=(
+    const BTree& other) {
+  if (this != &other) {
+    BTree copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+BTree<Value, Key, KeyOf>& BTree<Value, Key, KeyOf>::operator=(
+    BTree&& other) noexcept {
+  if (this != &other) {
+    BTree moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+// Iterators
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::iterator BTree<Value, Key, KeyOf>::begin() {
+  return size_ > 0 ? iterator(leftmost(root_), 0) : end();
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::iterator BTree<Value, Key, KeyOf>::end() {
+  return iterator();
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::const_iterator
+BTree<Value, Key, KeyOf>::begin() const {
+  return size_ > 0 ? const_iterator(leftmost(root_), 0) : end();
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::const_iterator
+BTree<Value, Key, KeyOf>::end() const {
+  return const_iterator();
+}
+
+// Capacity
+
+template <typename Value, typename Key, typename KeyOf>
+bool BTree<Value, Key, KeyOf>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::size_type BTree<Value, Key, KeyOf>::size()
+    const {
+  return size_;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::size_type
+BTree<Value, Key, KeyOf>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Value);
+}
+
+// Modifiers
+
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::clear() {
+  destroy(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+template <typename... Args>
+std::pair<typename BTree<Value, Key, KeyOf>::iterator, bool>
+BTree<Value, Key, KeyOf>::emplace_unique(const Key& key, Args&&... args) {
+  if (!root_) root_ = new_node(nullptr, true);
+  Node* node = root_;
+  size_type index;
+  for (;;) {
+    index = lower_index(node, key);
+    if (index < node->count && !(key < key_of(node, index))) {
+      return std::make_pair(iterator(node, index), false);
+    }
+    if (node->leaf) break;
+    node = child(node, index);
+  }
+  if (node->count < kSlots && index == node->count) {
+    ::new (static_cast<void*>(node->slot(index)))
+        Value(std::forward<Args>(args)...);
+  } else {
+    // Built first: args may refer to a value that is about to move
+    Value value(std::forward<Args>(args)...);
+    if (node->count == kSlots) {
+      split(node);
+      if (index > kSlots / 2) {
+        index -= kSlots / 2 + 1;
+        node = child(node->parent, node->position + 1);
+      }
+    }
+    shift_right(node, index);
+    try {
+      ::new (static_cast<void*>(node->slot(index))) Value(move_out(value));
+    } catch (...) {
+      shift_left(node, index);
+      throw;
+    }
+  }
+  ++node->count;
+  ++size_;
+  return std::make_pair(iterator(node, index), true);
+}
+
+// Values are copied, not moved: until every insertion has succeeded other
+// stays intact, and a throw only has to erase the copies made so far.
+// Keys of other die with the erased values, so the final erase looks them
+// up through the copies.
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::merge_unique(BTree& other) {
+  if (this == &other) return;
+  s21::Vector<const Key*> keys;
+  keys.reserve(other.size_);
+  try {
+    for (const Value& value : other) {
+      const Key& key = KeyOf()(value);
+      if (emplace_unique(key, value).second) keys.push_back(&key);
+    }
+  } catch (...) {
+    for (const Key* key : keys) erase(*key);
+    throw;
+  }
+  for (const Key*& key : keys) key = &KeyOf()(*find(*key));
+  for (const Key* key : keys) other.erase(*key);
+}
+
+// A value in an internal node is replaced by its in-order predecessor,
+// which always sits at the end of a leaf, so only leaves ever shrink
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::erase(const_iterator pos) {
+  Node* node = pos.node_;
+  if (!node) return;
+  const size_type index = pos.position_;
+  node->slot(index)->~Value();
+  if (node->leaf) {
+    shift_left(node, index);
+  } else {
+    Node* leaf = child(node, index);
+    while (!leaf->leaf) leaf = child(leaf, leaf->count);
+    relocate(node->slot(index), leaf->slot(leaf->count - 1));
+    node = leaf;
+  }
+  --node->count;
+  --size_;
+  rebalance(node);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::size_type BTree<Value, Key, KeyOf>::erase(
+    const Key& key) {
+  size_type index;
+  Node* node = find_node(key, index);
+  if (!node) return 0;
+  erase(const_iterator(node, index));
+  return 1;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::swap(BTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+// Lookup
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::iterator BTree<Value, Key, KeyOf>::find(
+    const Key& key) {
+  size_type index;
+  Node* node = find_node(key, index);
+  return node ? iterator(node, index) : end();
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::const_iterator
+BTree<Value, Key, KeyOf>::find(const Key& key) const {
+  size_type index;
+  Node* node = find_node(key, index);
+  return node ? const_iterator(node, index) : end();
+}
+
+template <typename Value, typename Key, typename KeyOf>
+bool BTree<Value, Key, KeyOf>::contains(const Key& key) const {
+  size_type index;
+  return find_node(key, index) != nullptr;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::iterator
+BTree<Value, Key, KeyOf>::lower_bound(const Key& key) {
+  size_type index;
+  Node* node = lower_bound_node(key, index);
+  return iterator(node, index);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::const_iterator
+BTree<Value, Key, KeyOf>::lower_bound(const Key& key) const {
+  size_type index;
+  Node* node = lower_bound_node(key, index);
+  return const_iterator(node, index);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::iterator
+BTree<Value, Key, KeyOf>::upper_bound(const Key& key) {
+  size_type index;
+  Node* node = upper_bound_node(key, index);
+  return iterator(node, index);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::const_iterator
+BTree<Value, Key, KeyOf>::upper_bound(const Key& key) const {
+  size_type index;
+  Node* node = upper_bound_node(key, index);
+  return const_iterator(node, index);
+}
+
+// Private helpers
+
+// Number of keys in node less than key. For arithmetic keys the whole
+// node is scanned without branches, which the compiler can vectorize;
+// other keys use binary search since each comparison may be expensive.
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::size_type
+BTree<Value, Key, KeyOf>::lower_index(const Node* node, const Key& key) {
+  if constexpr (std::is_arithmetic<Key>::value) {
+    size_type index = 0;
+    for (size_type i = 0; i < node->count; ++i) {
+      index += key_of(node, i) < key;
+    }
+    return index;
+  } else {
+    size_type low = 0;
+    size_type high = node->count;
+    while (low < high) {
+      size_type middle = (low + high) / 2;
+      if (key_of(node, middle) < key) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return low;
+  }
+}
+
+// Number of keys in node not greater than key
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::size_type
+BTree<Value, Key, KeyOf>::upper_index(const Node* node, const Key& key) {
+  if constexpr (std::is_arithmetic<Key>::value) {
+    size_type index = 0;
+    for (size_type i = 0; i < node->count; ++i) {
+      index += !(key < key_of(node, i));
+    }
+    return index;
+  } else {
+    size_type low = 0;
+    size_type high = node->count;
+    while (low < high) {
+      size_type middle = (low + high) / 2;
+      if (key < key_of(node, middle)) {
+        high = middle;
+      } else {
+        low = middle + 1;
+      }
+    }
+    return low;
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::Node* BTree<Value, Key, KeyOf>::new_node(
+    Node* parent, bool leaf) {
+  Node* node;
+  if (leaf) {
+    node = new Node;
+  } else {
+    InternalNode* internal = new InternalNode;
+    internal->children[0] = nullptr;
+    node = internal;
+  }
+  node->parent = parent;
+  node->position = 0;
+  node->count = 0;
+  node->leaf = leaf;
+  return node;
+}
+
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::delete_node(Node* node) {
+  if (node->leaf) {
+    delete node;
+  } else {
+    delete static_cast<InternalNode*>(node);
+  }
+}
+
+// Destroys the values of the subtree and frees its nodes
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::destroy(Node* node) {
+  if (!node) return;
+  if (!node->leaf) {
+    for (size_type i = 0; i <= node->count; ++i) destroy(child(node, i));
+  }
+  if constexpr (!std::is_trivially_destructible<Value>::value) {
+    for (size_type i = 0; i < node->count; ++i) node->slot(i)->~Value();
+  }
+  delete_node(node);
+}
+
+// Copies the subtree node by node without comparing keys. The copy keeps
+// children [0, count] valid at every step, so a partial copy can be
+// destroyed when a value constructor throws.
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::Node* BTree<Value, Key, KeyOf>::clone(
+    const Node* node, Node* parent) {
+  if (!node) return nullptr;
+  Node* copy = new_node(parent, node->leaf);
+  copy->position = node->position;
+  try {
+    if (!node->leaf) {
+      set_child(copy, 0, clone(child(node, 0), copy));
+    }
+    for (size_type i = 0; i < node->count; ++i) {
+      ::new (static_cast<void*>(copy->slot(i))) Value(*node->slot(i));
+      if (!node->leaf) {
+        try {
+          set_child(copy, i + 1, clone(child(node, i + 1), copy));
+        } catch (...) {
+          copy->slot(i)->~Value();
+          throw;
+        }
+      }
+      ++copy->count;
+    }
+  } catch (...) {
+    destroy(copy);
+    throw;
+  }
+  return copy;
+}
+
+// Moves the value at src into raw storage at dst. The key of a map entry
+// is const only for users of the tree; a value being relocated is about
+// to be destroyed, so its key is moved too instead of copied.
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::relocate(Value* dst, Value* src) {
+  if constexpr (kTriviallyRelocatable) {
+    std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src),
+                sizeof(Value));
+  } else {
+    ::new (static_cast<void*>(dst)) Value(move_out(*src));
+    src->~Value();
+  }
+}
+
+// Opens a gap at from by moving slots [from, count) one to the right
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::shift_right(Node* node, size_type from) {
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(node->slot(from + 1)),
+                 static_cast<const void*>(node->slot(from)),
+                 (node->count - from) * sizeof(Value));
+  } else {
+    for (size_type i = node->count; i > from; --i) {
+      relocate(node->slot(i), node->slot(i - 1));
+    }
+  }
+}
+
+// Closes the gap at from by moving slots (from, count) one to the left
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::shift_left(Node* node, size_type from) {
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(node->slot(from)),
+                 static_cast<const void*>(node->slot(from + 1)),
+                 (node->count - from - 1) * sizeof(Value));
+  } else {
+    for (size_type i = from + 1; i < node->count; ++i) {
+      relocate(node->slot(i - 1), node->slot(i));
+    }
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::transfer(Node* dst, size_type dst_index,
+                                        Node* src, size_type src_index,
+                                        size_type count) {
+  if constexpr (kTriviallyRelocatable) {
+    std::memcpy(static_cast<void*>(dst->slot(dst_index)),
+                static_cast<const void*>(src->slot(src_index)),
+                count * sizeof(Value));
+  } else {
+    for (size_type i = 0; i < count; ++i) {
+      relocate(dst->slot(dst_index + i), src->slot(src_index + i));
+    }
+  }
+}
+
+// Splits a full node around its middle value, which moves up into the
+// parent; a full parent is split first, and a split root grows the tree
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::split(Node* node) {
+  if (!node->parent) {
+    root_ = new_node(nullptr, false);
+    set_child(root_, 0, node);
+  } else if (node->parent->count == kSlots) {
+    split(node->parent);
+  }
+  Node* parent = node->parent;
+  const size_type middle = kSlots / 2;
+  const size_type moved = kSlots - middle - 1;
+  Node* sibling = new_node(parent, node->leaf);
+  transfer(sibling, 0, node, middle + 1, moved);
+  if (!node->leaf) {
+    for (size_type i = 0; i <= moved; ++i) {
+      set_child(sibling, i, child(node, middle + 1 + i));
+    }
+  }
+  sibling->count = static_cast<std::uint8_t>(moved);
+
+  const size_type position = node->position;
+  shift_right(parent, position);
+  for (size_type i = parent->count; i > position; --i) {
+    set_child(parent, i + 1, child(parent, i));
+  }
+  relocate(parent->slot(position), node->slot(middle));
+  set_child(parent, position + 1, sibling);
+  ++parent->count;
+  node->count = static_cast<std::uint8_t>(middle);
+}
+
+// Restores the minimum fill of node after a removal by borrowing a value
+// from a sibling or merging with it; a merge removes a value from the
+// parent, which may underflow in turn
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::rebalance(Node* node) {
+  while (node != root_ && node->count < kMinSlots) {
+    Node* parent = node->parent;
+    const size_type position = node->position;
+    Node* left = position > 0 ? child(parent, position - 1) : nullptr;
+    Node* right = position < parent->count ? child(parent, position + 1)
+                                           : nullptr;
+    if (left && left->count > kMinSlots) {
+      borrow_from_left(left, node);
+      return;
+    }
+    if (right && right->count > kMinSlots) {
+      borrow_from_right(node, right);
+      return;
+    }
+    if (left) {
+      merge_nodes(left, node);
+    } else {
+      merge_nodes(node, right);
+    }
+    node = parent;
+  }
+  if (root_ && root_->count == 0) {
+    Node* old_root = root_;
+    root_ = old_root->leaf ? nullptr : child(old_root, 0);
+    if (root_) {
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    delete_node(old_root);
+  }
+}
+
+// Rotates the last value of left up into the parent and the separator
+// down to the front of node
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::borrow_from_left(Node* left, Node* node) {
+  Node* parent = node->parent;
+  const size_type separator = node->position - 1;
+  shift_right(node, 0);
+  relocate(node->slot(0), parent->slot(separator));
+  relocate(parent->slot(separator), left->slot(left->count - 1));
+  if (!node->leaf) {
+    for (size_type i = node->count + 1; i > 0; --i) {
+      set_child(node, i, child(node, i - 1));
+    }
+    set_child(node, 0, child(left, left->count));
+  }
+  --left->count;
+  ++node->count;
+}
+
+// Rotates the first value of right up into the parent and the separator
+// down to the back of node
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::borrow_from_right(Node* node, Node* right) {
+  Node* parent = node->parent;
+  const size_type separator = node->position;
+  relocate(node->slot(node->count), parent->slot(separator));
+  relocate(parent->slot(separator), right->slot(0));
+  shift_left(right, 0);
+  if (!node->leaf) {
+    set_child(node, node->count + 1, child(right, 0));
+    for (size_type i = 0; i < right->count; ++i) {
+      set_child(right, i, child(right, i + 1));
+    }
+  }
+  ++node->count;
+  --right->count;
+}
+
+// Appends the separator and all of right to left, then drops right
+template <typename Value, typename Key, typename KeyOf>
+void BTree<Value, Key, KeyOf>::merge_nodes(Node* left, Node* right) {
+  Node* parent = left->parent;
+  const size_type separator = left->position;
+  relocate(left->slot(left->count), parent->slot(separator));
+  transfer(left, left->count + 1, right, 0, right->count);
+  if (!left->leaf) {
+    for (size_type i = 0; i <= right->count; ++i) {
+      set_child(left, left->count + 1 + i, child(right, i));
+    }
+  }
+  left->count = static_cast<std::uint8_t>(left->count + 1 + right->count);
+
+  shift_left(parent, separator);
+  for (size_type i = separator + 1; i < parent->count; ++i) {
+    set_child(parent, i, child(parent, i + 1));
+  }
+  --parent->count;
+  delete_node(right);
+}
+
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::Node* BTree<Value, Key, KeyOf>::find_node(
+    const Key& key, size_type& index) const {
+  Node* node = root_;
+  while (node) {
+    index = lower_index(node, key);
+    if (index < node->count && !(key < key_of(node, index))) return node;
+    node = node->leaf ? nullptr : child(node, index);
+  }
+  return nullptr;
+}
+
+// The first value not less than key, or a null node for end()
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::Node*
+BTree<Value, Key, KeyOf>::lower_bound_node(const Key& key,
+                                           size_type& index) const {
+  Node* result = nullptr;
+  index = 0;
+  Node* node = root_;
+  while (node) {
+    size_type i = lower_index(node, key);
+    if (i < node->count) {
+      result = node;
+      index = i;
+      if (!(key < key_of(node, i))) break;
+    }
+    node = node->leaf ? nullptr : child(node, i);
+  }
+  return result;
+}
+
+// The first value greater than key, or a null node for end()
+template <typename Value, typename Key, typename KeyOf>
+typename BTree<Value, Key, KeyOf>::Node*
+BTree<Value, Key, KeyOf>::upper_bound_node(const Key& key,
+                                           size_type& index) const {
+  Node* result = nullptr;
+  index = 0;
+  Node* node = root_;
+  while (node) {
+    size_type i = upper_index(node, key);
+    if (i < node->count) {
+      result = node;
+      index = i;
+    }
+    node = node->leaf ? nullptr : child(node, i);
+  }
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_H_
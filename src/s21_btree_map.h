@@ -0,0 +1,330 @@
+#ifndef S21_BTREE_MAP_H_
+#define S21_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Упорядоченный словарь на B-дереве (см. s21_btree.h) с интерфейсом
+// s21::Map: широкие узлы вместо узла на каждый элемент
+template <typename Key, typename T>
+class BTreeMap {
+ private:
+  // Извлечение ключа из хранимой пары
+  struct KeyOfPair {
+    const Key& operator()(const std::pair<const Key, T>& value) const {
+      return value.first;
+    }
+  };
+  using Tree = BTree<std::pair<const Key, T>, Key, KeyOfPair>;
+
+ public:
+  // Типы, определенные внутри класса
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::const_iterator;
+
+  // Конструкторы и деструктор
+  BTreeMap();
+  BTreeMap(std::initializer_list<value_type> const& items);
+  BTreeMap(const BTreeMap& m);
+  BTreeMap(BTreeMap&& m);
+  ~BTreeMap();
+
+  BTreeMap& operator=(const BTreeMap& m);
+  BTreeMap& operator=(BTreeMap&& m);
+
+  // Доступ к элементам
+  T& at(const Key& key);
+  const T& at(const Key& key) const;
+  T& operator[](const Key& key);
+
+  // Итераторы
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // Вместимость
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  // Модификаторы
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(BTreeMap& other);
+  void merge(BTreeMap& other);
+
+  // Поиск
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const;
+
+ private:
+  Tree tree_;
+};
+
+// Конструкторы и деструктор
+
+template <typename Key, typename T>
+BTreeMap<Key, T>::BTreeMap() : tree_() {}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>::BTreeMap(
+    std::initializer_list<value_type> const& items) {
+  for (const auto& item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>::BTreeMap(const BTreeMap& m)
+    : tree_(m.tree_) {}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>::BTreeMap(BTreeMap&& m)
+    : tree_(std::move(m.tree_)) {}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>::~BTreeMap() {}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>&
+BTreeMap<Key, T>::operator=(const BTreeMap& m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <typename Key, typename T>
+BTreeMap<Key, T>&
+BTreeMap<Key, T>::operator=(BTreeMap&& m) {
+  tree_ = std::move(m.tree_);
+  return *this;
+}
+
+// Доступ к элементам
+
+template <typename Key, typename T>
+T& BTreeMap<Key, T>::at(const Key& key) {
+  auto it = tree_.find(key);
+  if (it == tree_.end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+template <typename Key, typename T>
+const T& BTreeMap<Key, T>::at(const Key& key) const {
+  auto it = tree_.find(key);
+  if (it == tree_.end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+// Значение T() создается только при отсутствии ключа
+template <typename Key, typename T>
+T& BTreeMap<Key, T>::operator[](const Key& key) {
+  return try_emplace(key).first->second;
+}
+
+// Итераторы
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::iterator
+BTreeMap<Key, T>::begin() {
+  return tree_.begin();
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::iterator
+BTreeMap<Key, T>::end() {
+  return tree_.end();
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::const_iterator
+BTreeMap<Key, T>::begin() const {
+  return tree_.begin();
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::const_iterator
+BTreeMap<Key, T>::end() const {
+  return tree_.end();
+}
+
+// Вместимость
+
+template <typename Key, typename T>
+bool BTreeMap<Key, T>::empty() const {
+  return tree_.empty();
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::size_type
+BTreeMap<Key, T>::size() const {
+  return tree_.size();
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::size_type
+BTreeMap<Key, T>::max_size() const {
+  return tree_.max_size();
+}
+
+// Модификаторы
+
+template <typename Key, typename T>
+void BTreeMap<Key, T>::clear() {
+  tree_.clear();
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::iterator, bool>
+BTreeMap<Key, T>::insert(const value_type& value) {
+  return tree_.emplace_unique(value.first, value);
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::iterator, bool>
+BTreeMap<Key, T>::insert(value_type&& value) {
+  return tree_.emplace_unique(value.first, std::move(value));
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::iterator, bool>
+BTreeMap<Key, T>::insert(const Key& key, const T& obj) {
+  return tree_.emplace_unique(key, key, obj);
+}
+
+template <typename Key, typename T>
+template <typename... Args>
+std::pair<typename BTreeMap<Key, T>::iterator, bool>
+BTreeMap<Key, T>::try_emplace(const Key& key, Args&&... args) {
+  return tree_.emplace_unique(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::iterator, bool>
+BTreeMap<Key, T>::insert_or_assign(const Key& key,
+                                                       const T& obj) {
+  auto result = tree_.emplace_unique(key, key, obj);
+  if (!result.second) {
+    result.first->second = obj;
+  }
+  return result;
+}
+
+template <typename Key, typename T>
+void BTreeMap<Key, T>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::size_type
+BTreeMap<Key, T>::erase(const Key& key) {
+  return tree_.erase(key);
+}
+
+template <typename Key, typename T>
+void BTreeMap<Key, T>::swap(BTreeMap& other) {
+  tree_.swap(other.tree_);
+}
+
+// Переносит элементы, которых нет в текущем контейнере; совпадающие по
+// ключу остаются в other, как у std::map::merge. При исключении оба
+// контейнера остаются прежними (см. BTree::merge_unique)
+template <typename Key, typename T>
+void BTreeMap<Key, T>::merge(BTreeMap& other) {
+  tree_.merge_unique(other.tree_);
+}
+
+// Поиск
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::iterator
+BTreeMap<Key, T>::find(const Key& key) {
+  return tree_.find(key);
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::const_iterator
+BTreeMap<Key, T>::find(const Key& key) const {
+  return tree_.find(key);
+}
+
+template <typename Key, typename T>
+bool BTreeMap<Key, T>::contains(const Key& key) const {
+  return tree_.contains(key);
+}
+
+// Первый элемент с ключом не меньше key
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::iterator BTreeMap<Key, T>::lower_bound(
+    const Key& key) {
+  return tree_.lower_bound(key);
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::const_iterator BTreeMap<Key, T>::lower_bound(
+    const Key& key) const {
+  return tree_.lower_bound(key);
+}
+
+// Первый элемент с ключом больше key
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::iterator BTreeMap<Key, T>::upper_bound(
+    const Key& key) {
+  return tree_.upper_bound(key);
+}
+
+template <typename Key, typename T>
+typename BTreeMap<Key, T>::const_iterator BTreeMap<Key, T>::upper_bound(
+    const Key& key) const {
+  return tree_.upper_bound(key);
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::iterator,
+          typename BTreeMap<Key, T>::iterator>
+BTreeMap<Key, T>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T>
+std::pair<typename BTreeMap<Key, T>::const_iterator,
+          typename BTreeMap<Key, T>::const_iterator>
+BTreeMap<Key, T>::equal_range(const Key& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+}  // namespace s21
+
+#endif  // S21_BTREE_MAP_H_
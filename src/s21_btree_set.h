@@ -0,0 +1,88 @@
+#ifndef S21_BTREE_SET_H_
+#define S21_BTREE_SET_H_
+
+#include <initializer_list>
+#include <utility>
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Упорядоченное множество поверх того же B-дерева, что и s21::BTreeMap;
+// интерфейс повторяет s21::Set
+template <typename Key>
+class BTreeSet {
+ private:
+  // Ключом является само значение
+  struct Identity {
+    const Key& operator()(const Key& value) const { return value; }
+  };
+  using Tree = BTree<Key, Key, Identity>;
+
+ public:
+  // Типы
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  // Элементы множества менять нельзя, поэтому оба итератора константные
+  using iterator = typename Tree::const_iterator;
+  using const_iterator = typename Tree::const_iterator;
+
+  // Конструкторы
+  BTreeSet() = default;
+  BTreeSet(std::initializer_list<value_type> const& items) {
+    for (const auto& item : items) {
+      insert(item);
+    }
+  }
+  BTreeSet(const BTreeSet& other) = default;
+  BTreeSet(BTreeSet&& other) noexcept = default;
+  ~BTreeSet() = default;
+
+  // Операторы
+  BTreeSet& operator=(const BTreeSet& other) = default;
+  BTreeSet& operator=(BTreeSet&& other) noexcept = default;
+
+  // Итераторы
+  iterator begin() const { return tree_.begin(); }
+  iterator end() const { return tree_.end(); }
+
+  // Вместимость
+  bool empty() const { return tree_.empty(); }
+  size_type size() const { return tree_.size(); }
+  size_type max_size() const { return tree_.max_size(); }
+
+  // Модификаторы
+  void clear() { tree_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return tree_.emplace_unique(value, value);
+  }
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return tree_.emplace_unique(value, std::move(value));
+  }
+  void erase(iterator pos) { tree_.erase(pos); }
+  size_type erase(const key_type& key) { return tree_.erase(key); }
+  void swap(BTreeSet& other) noexcept { tree_.swap(other.tree_); }
+  // Элементы, уже присутствующие в текущем множестве, остаются в other;
+  // при исключении оба множества остаются прежними
+  void merge(BTreeSet& other) { tree_.merge_unique(other.tree_); }
+
+  // Поиск
+  iterator find(const key_type& key) const { return tree_.find(key); }
+  bool contains(const key_type& key) const { return tree_.contains(key); }
+  iterator lower_bound(const key_type& key) const {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const key_type& key) const {
+    return tree_.upper_bound(key);
+  }
+
+ private:
+  Tree tree_;
+};
+
+}  // namespace s21
+
+#endif  // S21_BTREE_SET_H_
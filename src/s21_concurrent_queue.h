@@ -0,0 +1,447 @@
+#ifndef S21_CONCURRENT_QUEUE_H
+#define S21_CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+namespace concurrent_queue_detail {
+
+constexpr std::size_t kCacheLine = 64;
+
+// Power of two not below requested and not below 2
+inline std::size_t round_capacity(std::size_t requested) {
+  std::size_t capacity = 2;
+  while (capacity < requested) {
+    if (capacity > (std::numeric_limits<std::size_t>::max() >> 1)) {
+      throw std::length_error("concurrent queue capacity too large");
+    }
+    capacity <<= 1;
+  }
+  return capacity;
+}
+
+}  // namespace concurrent_queue_detail
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Elements live in a power-of-two ring indexed by free-running
+// counters: the producer owns tail_, the consumer owns head_, and each side
+// keeps a cached copy of the other's index in its own cache line, so the
+// shared line is only read when the ring looks full (or empty). The buffer
+// is allocated once in the constructor; push and pop never allocate.
+//
+// try_push/try_emplace/push_many may only be called by the producer,
+// front/pop/try_pop/pop_many only by the consumer. size() and empty() are
+// exact on either side up to the other side's concurrent progress.
+template <typename T>
+class SpscQueue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // capacity is rounded up to a power of two
+  explicit SpscQueue(size_type capacity);
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+  ~SpscQueue();
+
+  // Producer
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(T&& value) { return try_emplace(std::move(value)); }
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  // Pushes as many leading elements of [first, last) as fit with a single
+  // publication of the tail and returns how many were pushed.
+  template <typename ForwardIt>
+  size_type push_many(ForwardIt first, ForwardIt last);
+
+  // Consumer
+  reference front();
+  void pop();
+  bool try_pop(T& out);
+  // Moves up to max_count elements to out with a single publication of the
+  // head and returns how many were moved.
+  template <typename OutputIt>
+  size_type pop_many(OutputIt out, size_type max_count);
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static constexpr std::size_t kCacheLine = concurrent_queue_detail::kCacheLine;
+
+  // Read-only after construction
+  alignas(kCacheLine) const size_type mask_;
+  T* const slots_;
+
+  // Consumer's line
+  alignas(kCacheLine) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+
+  // Producer's line
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+
+  // Keeps the next object off the producer's line
+  char padding_[kCacheLine - sizeof(std::atomic<size_type>) -
+                sizeof(size_type)];
+};
+
+// Bounded lock-free multi-producer multi-consumer queue after Dmitry
+// Vyukov's design. Each cell carries a sequence number that says whose turn
+// it is: sequence == pos means free for the producer that claims position
+// pos, sequence == pos + 1 means filled for the consumer of pos. Producers
+// and consumers claim positions with a CAS on their own cache-line-padded
+// counter and never touch each other's. Batch operations claim a run of
+// ready cells with one CAS.
+//
+// There is no front(): with several consumers the element could be taken
+// between looking at it and popping it. size() and empty() are snapshots.
+template <typename T>
+class MpmcQueue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+                    std::is_nothrow_move_assignable<T>::value &&
+                    std::is_nothrow_destructible<T>::value,
+                "a claimed cell must always be filled or drained");
+
+  explicit MpmcQueue(size_type capacity);
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+  ~MpmcQueue();
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(T&& value) { return try_emplace(std::move(value)); }
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  template <typename ForwardIt>
+  size_type push_many(ForwardIt first, ForwardIt last);
+
+  bool try_pop(T& out);
+  // Claimed elements cannot go back to the queue: if writing to out
+  // throws, the ones not written yet are destroyed and their cells
+  // released to producers before the exception propagates.
+  template <typename OutputIt>
+  size_type pop_many(OutputIt out, size_type max_count);
+
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept { return mask_ + 1; }
+
+ private:
+  static constexpr std::size_t kCacheLine = concurrent_queue_detail::kCacheLine;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  // Claims up to want consecutive cells starting at counter whose sequence
+  // equals position + lag. Returns the first claimed position and stores
+  // the number of claimed cells in claimed (zero when none is ready).
+  size_type claim(std::atomic<size_type>& counter, size_type lag,
+                  size_type want, size_type& claimed);
+
+  alignas(kCacheLine) const size_type mask_;
+  Cell* const cells_;
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0};
+  char padding_[kCacheLine - sizeof(std::atomic<size_type>)];
+};
+
+// SpscQueue
+
+template <typename T>
+SpscQueue<T>::SpscQueue(size_type capacity)
+    : mask_(concurrent_queue_detail::round_capacity(capacity) - 1),
+      slots_(std::allocator<T>().allocate(mask_ + 1)) {}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+      slots_[i & mask_].~T();
+    }
+  }
+  std::allocator<T>().deallocate(slots_, mask_ + 1);
+}
+
+template <typename T>
+template <typename... Args>
+bool SpscQueue<T>::try_emplace(Args&&... args) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_cache_ == capacity()) {
+    head_cache_ = head_.load(std::memory_order_acquire);
+    if (tail - head_cache_ == capacity()) return false;
+  }
+  ::new (static_cast<void*>(slots_ + (tail & mask_)))
+      T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+template <typename ForwardIt>
+typename SpscQueue<T>::size_type SpscQueue<T>::push_many(ForwardIt first,
+                                                         ForwardIt last) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  const size_type wanted = std::distance(first, last);
+  if (capacity() - (tail - head_cache_) < wanted) {
+    head_cache_ = head_.load(std::memory_order_acquire);
+  }
+  size_type count = capacity() - (tail - head_cache_);
+  if (count > wanted) count = wanted;
+  size_type pushed = 0;
+  try {
+    for (; pushed < count; ++pushed, ++first) {
+      ::new (static_cast<void*>(slots_ + ((tail + pushed) & mask_)))
+          T(*first);
+    }
+  } catch (...) {
+    tail_.store(tail + pushed, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+typename SpscQueue<T>::reference SpscQueue<T>::front() {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (head == tail_cache_) {
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    if (head == tail_cache_) {
+      throw std::runtime_error("front called on empty queue");
+    }
+  }
+  return slots_[head & mask_];
+}
+
+template <typename T>
+void SpscQueue<T>::pop() {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (head == tail_cache_) {
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    if (head == tail_cache_) {
+      throw std::runtime_error("pop called on empty queue");
+    }
+  }
+  slots_[head & mask_].~T();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool SpscQueue<T>::try_pop(T& out) {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (head == tail_cache_) {
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    if (head == tail_cache_) return false;
+  }
+  T& slot = slots_[head & mask_];
+  out = std::move(slot);
+  slot.~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename SpscQueue<T>::size_type SpscQueue<T>::pop_many(OutputIt out,
+                                                        size_type max_count) {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (tail_cache_ - head < max_count) {
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+  }
+  size_type count = tail_cache_ - head;
+  if (count > max_count) count = max_count;
+  size_type popped = 0;
+  try {
+    for (; popped < count; ++popped, ++out) {
+      T& slot = slots_[(head + popped) & mask_];
+      *out = std::move(slot);
+      slot.~T();
+    }
+  } catch (...) {
+    // The element that failed to move out stays at the front
+    head_.store(head + popped, std::memory_order_release);
+    throw;
+  }
+  head_.store(head + count, std::memory_order_release);
+  return count;
+}
+
+template <typename T>
+bool SpscQueue<T>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::size() const noexcept {
+  const size_type head = head_.load(std::memory_order_acquire);
+  const size_type tail = tail_.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+// MpmcQueue
+
+template <typename T>
+MpmcQueue<T>::MpmcQueue(size_type capacity)
+    : mask_(concurrent_queue_detail::round_capacity(capacity) - 1),
+      cells_(new Cell[mask_ + 1]) {
+  for (size_type i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_type i = dequeue_pos_.load(std::memory_order_relaxed);
+         i != tail; ++i) {
+      cells_[i & mask_].value()->~T();
+    }
+  }
+  delete[] cells_;
+}
+
+// Sequence arithmetic is done on the signed difference so that it stays
+// correct when the counters wrap.
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::claim(
+    std::atomic<size_type>& counter, size_type lag, size_type want,
+    size_type& claimed) {
+  size_type pos = counter.load(std::memory_order_relaxed);
+  for (;;) {
+    size_type ready = 0;
+    std::intptr_t diff = 0;
+    while (ready < want) {
+      const size_type sequence = cells_[(pos + ready) & mask_].sequence.load(
+          std::memory_order_acquire);
+      diff = static_cast<std::intptr_t>(sequence - (pos + ready + lag));
+      if (diff != 0) break;
+      ++ready;
+    }
+    if (ready > 0) {
+      if (counter.compare_exchange_weak(pos, pos + ready,
+                                        std::memory_order_relaxed)) {
+        claimed = ready;
+        return pos;
+      }
+    } else if (diff < 0) {
+      claimed = 0;  // Full for producers, empty for consumers
+      return pos;
+    } else {
+      pos = counter.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::try_emplace(Args&&... args) {
+  if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+    // Build first: a claimed cell must not be left empty by an exception
+    return try_emplace(T(std::forward<Args>(args)...));
+  } else {
+    size_type claimed;
+    const size_type pos = claim(enqueue_pos_, 0, 1, claimed);
+    if (claimed == 0) return false;
+    Cell& cell = cells_[pos & mask_];
+    ::new (static_cast<void*>(cell.storage)) T(std::forward<Args>(args)...);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+}
+
+template <typename T>
+template <typename ForwardIt>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::push_many(ForwardIt first,
+                                                         ForwardIt last) {
+  using Ref = decltype(*first);
+  const size_type wanted = std::distance(first, last);
+  if constexpr (!std::is_nothrow_constructible<T, Ref>::value) {
+    size_type pushed = 0;
+    for (; first != last && try_push(*first); ++first) ++pushed;
+    return pushed;
+  } else {
+    if (wanted == 0) return 0;
+    size_type claimed;
+    const size_type pos = claim(enqueue_pos_, 0, wanted, claimed);
+    for (size_type i = 0; i < claimed; ++i, ++first) {
+      ::new (static_cast<void*>(cells_[(pos + i) & mask_].storage)) T(*first);
+    }
+    // Published in order so consumers see a growing prefix
+    for (size_type i = 0; i < claimed; ++i) {
+      cells_[(pos + i) & mask_].sequence.store(pos + i + 1,
+                                               std::memory_order_release);
+    }
+    return claimed;
+  }
+}
+
+template <typename T>
+bool MpmcQueue<T>::try_pop(T& out) {
+  return pop_many(&out, 1) == 1;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::pop_many(OutputIt out,
+                                                        size_type max_count) {
+  if (max_count == 0) return 0;
+  size_type claimed;
+  const size_type pos = claim(dequeue_pos_, 1, max_count, claimed);
+  size_type i = 0;
+  try {
+    for (; i < claimed; ++i, ++out) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      *out = std::move(*cell.value());
+      cell.value()->~T();
+      cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+  } catch (...) {
+    // An unreleased cell would stall every producer that reaches it
+    for (; i < claimed; ++i) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      cell.value()->~T();
+      cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    throw;
+  }
+  return claimed;
+}
+
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::size() const noexcept {
+  const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  // Consumers may have claimed cells the snapshot of tail does not cover
+  const std::intptr_t diff = static_cast<std::intptr_t>(tail - head);
+  return diff > 0 ? static_cast<size_type>(diff) : 0;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_QUEUE_H
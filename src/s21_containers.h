@@ -1,11 +1,28 @@
 #ifndef S21_CONTAINERS_H_
 #define S21_CONTAINERS_H_
 
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_concurrent_queue.h"
+#include "s21_deque.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_growth_policy.h"
+#include "s21_incremental_vector.h"
 #include "s21_list.h"
 #include "s21_map.h"
+#include "s21_mapped_vector.h"
+#include "s21_memory_resource.h"
+#include "s21_parallel.h"
+#include "s21_priority_queue.h"
 #include "s21_queue.h"
 #include "s21_set.h"
+#include "s21_small_vector.h"
 #include "s21_stack.h"
+#include "s21_thread_pool.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
 #include "s21_vector.h"
+#include "s21_work_stealing_deque.h"
 
 #endif  // S21_CONTAINERS_H_
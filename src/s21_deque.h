@@ -0,0 +1,489 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Double-ended queue over a circular buffer. Capacity is always a power of
+// two so positions wrap with a mask; growth doubles the buffer and unwraps
+// the elements to its start. The buffer is never shrunk implicitly, so a
+// queue that has reached its working size stops allocating. Allocator
+// follows the same rules as in s21::Vector.
+template <typename T, typename Allocator = std::allocator<T>>
+class Deque {
+ public:
+  // Member types
+  using allocator_type = Allocator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  template <typename Value>
+  class DequeIterator;
+  using iterator = DequeIterator<T>;
+  using const_iterator = DequeIterator<const T>;
+
+  // Constructors
+  Deque();
+  explicit Deque(const allocator_type& alloc);
+  Deque(std::initializer_list<value_type> const& items,
+        const allocator_type& alloc = allocator_type());
+  Deque(const Deque& d);
+  Deque(const Deque& d, const allocator_type& alloc);
+  Deque(Deque&& d);
+  Deque(Deque&& d, const allocator_type& alloc);
+  ~Deque();
+
+  // Operator=
+  Deque& operator=(const Deque& d);
+  Deque& operator=(Deque&& d);
+
+  // Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  allocator_type get_allocator() const;
+
+  // Iterators
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+
+  // Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+
+  // Modifiers
+  void clear();
+  void push_back(const_reference value);
+  void push_back(T&& value);
+  void push_front(const_reference value);
+  void push_front(T&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  void pop_back();
+  void pop_front();
+  void swap(Deque& other);
+
+ private:
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<T>::value;
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  [[no_unique_address]] Allocator alloc_;
+  T* data_;
+  size_type head_;  // Physical index of front()
+  size_type size_;
+  size_type capacity_;  // Zero or a power of two
+
+  size_type slot(size_type pos) const {
+    return (head_ + pos) & (capacity_ - 1);
+  }
+  void reallocate(size_type new_capacity);
+  void grow_if_full();
+  void steal(Deque& d) noexcept;
+};
+
+template <typename T, typename A>
+template <typename Value>
+class Deque<T, A>::DequeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename Deque::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value*;
+  using reference = Value&;
+  using deque_pointer =
+      std::conditional_t<std::is_const<Value>::value, const Deque*, Deque*>;
+
+  DequeIterator(deque_pointer deque = nullptr, size_type pos = 0)
+      : deque_(deque), pos_(pos) {}
+
+  reference operator*() const { return (*deque_)[pos_]; }
+  pointer operator->() const { return &(*deque_)[pos_]; }
+
+  DequeIterator& operator++() {
+    ++pos_;
+    return *this;
+  }
+  DequeIterator operator++(int) {
+    DequeIterator tmp = *this;
+    ++pos_;
+    return tmp;
+  }
+  DequeIterator& operator--() {
+    --pos_;
+    return *this;
+  }
+  DequeIterator operator--(int) {
+    DequeIterator tmp = *this;
+    --pos_;
+    return tmp;
+  }
+
+  bool operator==(const DequeIterator& other) const {
+    return deque_ == other.deque_ && pos_ == other.pos_;
+  }
+  bool operator!=(const DequeIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  deque_pointer deque_;
+  size_type pos_;  // Logical position, 0 is front()
+};
+
+// Implementations
+
+// Constructors
+template <typename T, typename A>
+Deque<T, A>::Deque() : Deque(allocator_type()) {}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(const allocator_type& alloc)
+    : alloc_(alloc), data_(nullptr), head_(0), size_(0), capacity_(0) {}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(std::initializer_list<value_type> const& items,
+                   const allocator_type& alloc)
+    : Deque(alloc) {
+  reserve(items.size());
+  for (const auto& item : items) {
+    push_back(item);
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(const Deque& d)
+    : Deque(d,
+            AllocTraits::select_on_container_copy_construction(d.alloc_)) {}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(const Deque& d, const allocator_type& alloc)
+    : Deque(alloc) {
+  reserve(d.size_);
+  for (size_type i = 0; i < d.size_; ++i) {
+    push_back(d[i]);
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::Deque(Deque&& d) : Deque(d.alloc_) {
+  steal(d);
+}
+
+// Elements are moved one by one when the buffer cannot change allocators
+template <typename T, typename A>
+Deque<T, A>::Deque(Deque&& d, const allocator_type& alloc) : Deque(alloc) {
+  if (alloc_ == d.alloc_) {
+    steal(d);
+  } else {
+    reserve(d.size_);
+    for (; size_ < d.size_; ++size_) {
+      AllocTraits::construct(alloc_, data_ + size_, std::move(d[size_]));
+    }
+    d.clear();
+  }
+}
+
+template <typename T, typename A>
+Deque<T, A>::~Deque() {
+  clear();
+  if (data_) AllocTraits::deallocate(alloc_, data_, capacity_);
+}
+
+// Operator=
+template <typename T, typename A>
+Deque<T, A>& Deque<T, A>::operator=(const Deque& d) {
+  if (this != &d) {
+    Deque copy(d, alloc_);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, typename A>
+Deque<T, A>& Deque<T, A>::operator=(Deque&& d) {
+  if (this != &d) {
+    Deque moved(std::move(d), alloc_);
+    swap(moved);
+  }
+  return *this;
+}
+
+// Element access
+template <typename T, typename A>
+typename Deque<T, A>::reference Deque<T, A>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Deque::at: index out of range");
+  }
+  return data_[slot(pos)];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::reference Deque<T, A>::operator[](size_type pos) {
+  return data_[slot(pos)];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_reference Deque<T, A>::operator[](
+    size_type pos) const {
+  return data_[slot(pos)];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::allocator_type Deque<T, A>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::reference Deque<T, A>::front() {
+  if (empty()) throw std::runtime_error("front called on empty deque");
+  return data_[head_];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_reference Deque<T, A>::front() const {
+  if (empty()) throw std::runtime_error("front called on empty deque");
+  return data_[head_];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::reference Deque<T, A>::back() {
+  if (empty()) throw std::runtime_error("back called on empty deque");
+  return data_[slot(size_ - 1)];
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_reference Deque<T, A>::back() const {
+  if (empty()) throw std::runtime_error("back called on empty deque");
+  return data_[slot(size_ - 1)];
+}
+
+// Iterators
+template <typename T, typename A>
+typename Deque<T, A>::iterator Deque<T, A>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_iterator Deque<T, A>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::iterator Deque<T, A>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::const_iterator Deque<T, A>::end() const {
+  return const_iterator(this, size_);
+}
+
+// Capacity
+template <typename T, typename A>
+bool Deque<T, A>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::size_type Deque<T, A>::size() const {
+  return size_;
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::size_type Deque<T, A>::max_size() const {
+  return (std::numeric_limits<size_type>::max() / 2 + 1) / sizeof(T);
+}
+
+template <typename T, typename A>
+void Deque<T, A>::reserve(size_type new_capacity) {
+  if (new_capacity > capacity_) {
+    size_type rounded = capacity_ > 0 ? capacity_ : 1;
+    while (rounded < new_capacity) rounded *= 2;
+    reallocate(rounded);
+  }
+}
+
+template <typename T, typename A>
+typename Deque<T, A>::size_type Deque<T, A>::capacity() const {
+  return capacity_;
+}
+
+// Modifiers
+template <typename T, typename A>
+void Deque<T, A>::clear() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 0; i < size_; ++i) {
+      AllocTraits::destroy(alloc_, data_ + slot(i));
+    }
+  }
+  head_ = 0;
+  size_ = 0;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename A>
+void Deque<T, A>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename A>
+void Deque<T, A>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename A>
+void Deque<T, A>::push_front(T&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Deque<T, A>::reference Deque<T, A>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);  // args may live in the old buffer
+    grow_if_full();
+    AllocTraits::construct(alloc_, data_ + slot(size_), std::move(value));
+  } else {
+    AllocTraits::construct(alloc_, data_ + slot(size_),
+                           std::forward<Args>(args)...);
+  }
+  ++size_;
+  return data_[slot(size_ - 1)];
+}
+
+template <typename T, typename A>
+template <typename... Args>
+typename Deque<T, A>::reference Deque<T, A>::emplace_front(Args&&... args) {
+  if (size_ == capacity_) {
+    T value(std::forward<Args>(args)...);
+    grow_if_full();
+    size_type front = (head_ - 1) & (capacity_ - 1);
+    AllocTraits::construct(alloc_, data_ + front, std::move(value));
+    head_ = front;
+  } else {
+    size_type front = (head_ - 1) & (capacity_ - 1);
+    AllocTraits::construct(alloc_, data_ + front, std::forward<Args>(args)...);
+    head_ = front;
+  }
+  ++size_;
+  return data_[head_];
+}
+
+template <typename T, typename A>
+void Deque<T, A>::pop_back() {
+  if (empty()) throw std::runtime_error("pop_back called on empty deque");
+  AllocTraits::destroy(alloc_, data_ + slot(size_ - 1));
+  --size_;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::pop_front() {
+  if (empty()) throw std::runtime_error("pop_front called on empty deque");
+  AllocTraits::destroy(alloc_, data_ + head_);
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::swap(Deque& other) {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(data_, other.data_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// Private member functions
+
+// Moves the elements into a new buffer, unwrapping them so that front()
+// lands at index 0.
+template <typename T, typename A>
+void Deque<T, A>::reallocate(size_type new_capacity) {
+  T* new_data = AllocTraits::allocate(alloc_, new_capacity);
+  size_type first_part = size_ < capacity_ - head_ ? size_ : capacity_ - head_;
+  if constexpr (kTriviallyRelocatable) {
+    if (size_ > 0) {
+      std::memcpy(static_cast<void*>(new_data), data_ + head_,
+                  first_part * sizeof(T));
+      std::memcpy(static_cast<void*>(new_data + first_part), data_,
+                  (size_ - first_part) * sizeof(T));
+    }
+  } else {
+    size_type moved = 0;
+    try {
+      for (; moved < size_; ++moved) {
+        AllocTraits::construct(alloc_, new_data + moved,
+                               std::move_if_noexcept(data_[slot(moved)]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i) {
+        AllocTraits::destroy(alloc_, new_data + i);
+      }
+      AllocTraits::deallocate(alloc_, new_data, new_capacity);
+      throw;
+    }
+    for (size_type i = 0; i < size_; ++i) {
+      AllocTraits::destroy(alloc_, data_ + slot(i));
+    }
+  }
+  if (data_) AllocTraits::deallocate(alloc_, data_, capacity_);
+  data_ = new_data;
+  head_ = 0;
+  capacity_ = new_capacity;
+}
+
+template <typename T, typename A>
+void Deque<T, A>::grow_if_full() {
+  if (size_ == capacity_) {
+    reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+  }
+}
+
+// Takes over d's buffer; the allocators must compare equal.
+template <typename T, typename A>
+void Deque<T, A>::steal(Deque& d) noexcept {
+  std::swap(data_, d.data_);
+  std::swap(head_, d.head_);
+  std::swap(size_, d.size_);
+  std::swap(capacity_, d.capacity_);
+}
+
+namespace pmr {
+template <typename T>
+using Deque = s21::Deque<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_DEQUE_H
@@ -0,0 +1,506 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_flat_search.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Упорядоченный словарь на двух отсортированных массивах s21::Vector:
+// ключи отдельно от значений, поэтому двоичный поиск читает только
+// плотный массив ключей. Вставка и удаление одного элемента - O(n), так
+// что словарь рассчитан на данные, которые строятся один раз (пакетом
+// через конструктор из диапазона или insert(first, last)) и потом много
+// читаются. Интерфейс повторяет s21::Map.
+//
+// Пары (ключ, значение) в памяти не хранятся: итератор - это пара
+// указателей, а разыменование дает std::pair<const Key&, T&>, как у
+// std::flat_map из C++23. it->first и it->second работают как обычно
+template <typename Key, typename T>
+class FlatMap {
+ public:
+  // Типы
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type&, mapped_type&>;
+  using const_reference = std::pair<const key_type&, const mapped_type&>;
+  using size_type = std::size_t;
+
+  template <bool Const>
+  class FlatMapIterator;
+  using iterator = FlatMapIterator<false>;
+  using const_iterator = FlatMapIterator<true>;
+
+  // Конструкторы и деструктор
+  FlatMap() = default;
+  FlatMap(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  FlatMap(InputIt first, InputIt last);
+  FlatMap(const FlatMap& m) = default;
+  FlatMap(FlatMap&& m) = default;
+  ~FlatMap() = default;
+
+  FlatMap& operator=(const FlatMap& m) = default;
+  FlatMap& operator=(FlatMap&& m) = default;
+
+  // Доступ к элементам
+  T& at(const Key& key);
+  const T& at(const Key& key) const;
+  T& operator[](const Key& key);
+  // Массивы ключей и значений целиком (элемент i одного соответствует
+  // элементу i другого)
+  const s21::Vector<Key>& keys() const { return keys_; }
+  const s21::Vector<T>& values() const { return values_; }
+
+  // Итераторы
+  iterator begin() { return iterator(keys_.data(), values_.data()); }
+  iterator end() { return begin() + size(); }
+  const_iterator begin() const {
+    return const_iterator(keys_.data(), values_.data());
+  }
+  const_iterator end() const { return begin() + size(); }
+
+  // Вместимость
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const;
+  void reserve(size_type count);
+
+  // Модификаторы
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  // Пакетная вставка: сортировка новых элементов и одно слияние за
+  // O(n + k log k); при повторе ключа остается первое значение
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(FlatMap& other);
+  // Элементы с ключами, уже присутствующими в текущем словаре, остаются
+  // в other
+  void merge(FlatMap& other);
+
+  // Поиск
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const;
+
+ private:
+  // Позиция ключа в массиве или size(), если его нет
+  size_type find_index(const Key& key) const;
+  size_type lower_bound_index(const Key& key) const {
+    return flat_detail::lower_bound_index(keys_.data(), keys_.size(), key);
+  }
+  size_type upper_bound_index(const Key& key) const {
+    return flat_detail::upper_bound_index(keys_.data(), keys_.size(), key);
+  }
+  iterator at_index(size_type index) { return begin() + index; }
+  // Вставка нового элемента перед index, значение строится из args прямо
+  // в массиве; ключ и значение добавляются вместе или не добавляются вовсе
+  template <typename... Args>
+  void insert_at(size_type index, const Key& key, Args&&... args);
+  // Добавление элемента в конец при слиянии отсортированных массивов
+  template <typename K, typename V>
+  void append(K&& key, V&& obj);
+
+  // Собственные элементы при слиянии переносятся, только если перенос не
+  // бросает: место в результате зарезервировано заранее, так что
+  // исключение не оставит словарь с перемещенными ключами и значениями.
+  // Иначе они копируются
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible<Key>::value &&
+      std::is_nothrow_move_constructible<T>::value;
+  template <typename U>
+  static decltype(auto) take(U& item) {
+    return flat_detail::take<kNothrowMove>(item);
+  }
+
+  s21::Vector<Key> keys_;
+  s21::Vector<T> values_;
+};
+
+// Итератор произвольного доступа по двум параллельным массивам
+template <typename Key, typename T>
+template <bool Const>
+class FlatMap<Key, T>::FlatMapIterator {
+  using MappedRef = std::conditional_t<Const, const T&, T&>;
+  using MappedPtr = std::conditional_t<Const, const T*, T*>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::pair<Key, T>;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key&, MappedRef>;
+  // operator-> возвращает временную пару по значению
+  struct pointer {
+    reference ref;
+    const reference* operator->() const { return &ref; }
+  };
+
+  FlatMapIterator() : key_(nullptr), value_(nullptr) {}
+  FlatMapIterator(const Key* key, MappedPtr value)
+      : key_(key), value_(value) {}
+  // iterator -> const_iterator
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  FlatMapIterator(const FlatMapIterator<false>& other)
+      : key_(other.key_), value_(other.value_) {}
+
+  reference operator*() const { return reference(*key_, *value_); }
+  pointer operator->() const { return pointer{**this}; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  FlatMapIterator& operator++() {
+    ++key_;
+    ++value_;
+    return *this;
+  }
+  FlatMapIterator operator++(int) {
+    FlatMapIterator old = *this;
+    ++*this;
+    return old;
+  }
+  FlatMapIterator& operator--() {
+    --key_;
+    --value_;
+    return *this;
+  }
+  FlatMapIterator operator--(int) {
+    FlatMapIterator old = *this;
+    --*this;
+    return old;
+  }
+  FlatMapIterator& operator+=(difference_type n) {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+  FlatMapIterator& operator-=(difference_type n) { return *this += -n; }
+
+  friend FlatMapIterator operator+(FlatMapIterator it, difference_type n) {
+    return it += n;
+  }
+  friend FlatMapIterator operator+(difference_type n, FlatMapIterator it) {
+    return it += n;
+  }
+  friend FlatMapIterator operator-(FlatMapIterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const FlatMapIterator& a,
+                                   const FlatMapIterator& b) {
+    return a.key_ - b.key_;
+  }
+  friend bool operator==(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return a.key_ == b.key_;
+  }
+  friend bool operator!=(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return a.key_ != b.key_;
+  }
+  friend bool operator<(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return a.key_ < b.key_;
+  }
+  friend bool operator>(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return b < a;
+  }
+  friend bool operator<=(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return !(b < a);
+  }
+  friend bool operator>=(const FlatMapIterator& a, const FlatMapIterator& b) {
+    return !(a < b);
+  }
+
+ private:
+  template <bool>
+  friend class FlatMapIterator;
+  friend class FlatMap;
+
+  const Key* key_;
+  MappedPtr value_;
+};
+
+// Конструкторы
+
+template <typename Key, typename T>
+FlatMap<Key, T>::FlatMap(std::initializer_list<value_type> const& items) {
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename T>
+template <typename InputIt>
+FlatMap<Key, T>::FlatMap(InputIt first, InputIt last) {
+  insert(first, last);
+}
+
+// Доступ к элементам
+
+template <typename Key, typename T>
+T& FlatMap<Key, T>::at(const Key& key) {
+  const size_type index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range("FlatMap::at: key not found");
+  }
+  return values_[index];
+}
+
+template <typename Key, typename T>
+const T& FlatMap<Key, T>::at(const Key& key) const {
+  const size_type index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range("FlatMap::at: key not found");
+  }
+  return values_[index];
+}
+
+template <typename Key, typename T>
+T& FlatMap<Key, T>::operator[](const Key& key) {
+  return try_emplace(key).first->second;
+}
+
+// Вместимость
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::max_size() const {
+  return std::min(keys_.max_size(), values_.max_size());
+}
+
+template <typename Key, typename T>
+void FlatMap<Key, T>::reserve(size_type count) {
+  keys_.reserve(count);
+  values_.reserve(count);
+}
+
+// Модификаторы
+
+template <typename Key, typename T>
+void FlatMap<Key, T>::clear() {
+  keys_.clear();
+  values_.clear();
+}
+
+template <typename Key, typename T>
+template <typename... Args>
+void FlatMap<Key, T>::insert_at(size_type index, const Key& key,
+                                Args&&... args) {
+  keys_.insert(keys_.begin() + index, key);
+  try {
+    values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+  } catch (...) {
+    keys_.erase(keys_.begin() + index);
+    throw;
+  }
+}
+
+template <typename Key, typename T>
+template <typename K, typename V>
+void FlatMap<Key, T>::append(K&& key, V&& obj) {
+  keys_.push_back(std::forward<K>(key));
+  try {
+    values_.push_back(std::forward<V>(obj));
+  } catch (...) {
+    keys_.pop_back();
+    throw;
+  }
+}
+
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool> FlatMap<Key, T>::insert(
+    const value_type& value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool> FlatMap<Key, T>::insert(
+    const Key& key, const T& obj) {
+  const size_type index = lower_bound_index(key);
+  if (index < size() && !(key < keys_[index])) {
+    return {at_index(index), false};
+  }
+  insert_at(index, key, obj);
+  return {at_index(index), true};
+}
+
+template <typename Key, typename T>
+template <typename InputIt>
+void FlatMap<Key, T>::insert(InputIt first, InputIt last) {
+  using Item = std::pair<Key, T>;
+  s21::Vector<Item> batch;
+  for (; first != last; ++first) {
+    batch.push_back(Item((*first).first, (*first).second));
+  }
+  flat_detail::sort_unique(batch,
+                           [](const Item& item) -> const Key& {
+                             return item.first;
+                           });
+  const auto plan = flat_detail::merge_plan(
+      keys_, batch, [](const Item& item) -> const Key& { return item.first; });
+  FlatMap merged;
+  merged.reserve(plan.size());
+  size_type i = 0;
+  size_type j = 0;
+  for (flat_detail::MergeStep step : plan) {
+    if (step == flat_detail::kSecond) {
+      merged.append(std::move(batch[j].first), std::move(batch[j].second));
+      ++j;
+    } else {  // При равных ключах остается прежнее значение
+      merged.append(take(keys_[i]), take(values_[i]));
+      ++i;
+      if (step == flat_detail::kBoth) ++j;
+    }
+  }
+  swap(merged);
+}
+
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator, bool>
+FlatMap<Key, T>::insert_or_assign(const Key& key, const T& obj) {
+  auto result = insert(key, obj);
+  if (!result.second) result.first->second = obj;
+  return result;
+}
+
+template <typename Key, typename T>
+template <typename... Args>
+std::pair<typename FlatMap<Key, T>::iterator, bool>
+FlatMap<Key, T>::try_emplace(const Key& key, Args&&... args) {
+  const size_type index = lower_bound_index(key);
+  if (index < size() && !(key < keys_[index])) {
+    return {at_index(index), false};
+  }
+  insert_at(index, key, std::forward<Args>(args)...);
+  return {at_index(index), true};
+}
+
+template <typename Key, typename T>
+void FlatMap<Key, T>::erase(iterator pos) {
+  const size_type index = pos.key_ - keys_.data();
+  keys_.erase(keys_.begin() + index);
+  values_.erase(values_.begin() + index);
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::erase(const Key& key) {
+  const size_type index = find_index(key);
+  if (index == size()) return 0;
+  erase(at_index(index));
+  return 1;
+}
+
+template <typename Key, typename T>
+void FlatMap<Key, T>::swap(FlatMap& other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+}
+
+template <typename Key, typename T>
+void FlatMap<Key, T>::merge(FlatMap& other) {
+  if (this == &other) return;
+  const auto plan = flat_detail::merge_plan(
+      keys_, other.keys_, [](const Key& key) -> const Key& { return key; });
+  const size_type common = size() + other.size() - plan.size();
+  FlatMap merged;
+  FlatMap rest;
+  merged.reserve(plan.size());
+  rest.reserve(common);
+  size_type i = 0;
+  size_type j = 0;
+  for (flat_detail::MergeStep step : plan) {
+    if (step == flat_detail::kSecond) {
+      merged.append(take(other.keys_[j]), take(other.values_[j]));
+      ++j;
+      continue;
+    }
+    merged.append(take(keys_[i]), take(values_[i]));
+    ++i;
+    // Ключ есть в обоих: наш идет в merged, чужой остается в other
+    if (step == flat_detail::kBoth) {
+      rest.append(take(other.keys_[j]), take(other.values_[j]));
+      ++j;
+    }
+  }
+  swap(merged);
+  other.swap(rest);
+}
+
+// Поиск
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::size_type FlatMap<Key, T>::find_index(
+    const Key& key) const {
+  const size_type index = lower_bound_index(key);
+  return index < size() && !(key < keys_[index]) ? index : size();
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::find(const Key& key) {
+  return at_index(find_index(key));
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::find(
+    const Key& key) const {
+  return begin() + find_index(key);
+}
+
+template <typename Key, typename T>
+bool FlatMap<Key, T>::contains(const Key& key) const {
+  return find_index(key) != size();
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::lower_bound(
+    const Key& key) {
+  return at_index(lower_bound_index(key));
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::lower_bound(
+    const Key& key) const {
+  return begin() + lower_bound_index(key);
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::iterator FlatMap<Key, T>::upper_bound(
+    const Key& key) {
+  return at_index(upper_bound_index(key));
+}
+
+template <typename Key, typename T>
+typename FlatMap<Key, T>::const_iterator FlatMap<Key, T>::upper_bound(
+    const Key& key) const {
+  return begin() + upper_bound_index(key);
+}
+
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::iterator,
+          typename FlatMap<Key, T>::iterator>
+FlatMap<Key, T>::equal_range(const Key& key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename Key, typename T>
+std::pair<typename FlatMap<Key, T>::const_iterator,
+          typename FlatMap<Key, T>::const_iterator>
+FlatMap<Key, T>::equal_range(const Key& key) const {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MAP_H_
@@ -0,0 +1,113 @@
+#ifndef S21_FLAT_SEARCH_H_
+#define S21_FLAT_SEARCH_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Search and bulk-build helpers shared by FlatMap and FlatSet, which keep
+// their keys sorted and unique in one contiguous s21::Vector.
+namespace flat_detail {
+
+// Index of the first key not less than key. The loop halves the range
+// with a conditional move instead of a branch, so for machine-word keys it
+// runs a fixed number of iterations without mispredictions; every probe
+// still costs one operator< as in std::lower_bound.
+template <typename Key>
+std::size_t lower_bound_index(const Key* keys, std::size_t n,
+                              const Key& key) {
+  if (n == 0) return 0;
+  const Key* base = keys;
+  while (n > 1) {
+    const std::size_t half = n / 2;
+    base = (base[half - 1] < key) ? base + half : base;
+    n -= half;
+  }
+  return (base - keys) + (*base < key);
+}
+
+// Index of the first key greater than key
+template <typename Key>
+std::size_t upper_bound_index(const Key* keys, std::size_t n,
+                              const Key& key) {
+  if (n == 0) return 0;
+  const Key* base = keys;
+  while (n > 1) {
+    const std::size_t half = n / 2;
+    base = (key < base[half - 1]) ? base : base + half;
+    n -= half;
+  }
+  return (base - keys) + !(key < *base);
+}
+
+// Sorts batch by get_key and drops every element whose key was already
+// seen earlier in the batch, so the first occurrence wins as with repeated
+// insert calls
+template <typename Value, typename GetKey>
+void sort_unique(s21::Vector<Value>& batch, GetKey get_key) {
+  auto less = [&get_key](const Value& a, const Value& b) {
+    return get_key(a) < get_key(b);
+  };
+  std::stable_sort(batch.begin(), batch.end(), less);
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    if (kept == 0 || get_key(batch[kept - 1]) < get_key(batch[i])) {
+      if (kept != i) batch[kept] = std::move(batch[i]);
+      ++kept;
+    }
+  }
+  while (batch.size() > kept) batch.pop_back();
+}
+
+// One step of merging two sorted unique key arrays: take the next element
+// of the first, of the second, or of both when their keys are equal
+enum MergeStep : unsigned char { kFirst, kSecond, kBoth };
+
+// Every comparison of a merge, done before any element is taken: the
+// merge itself then cannot throw from operator< halfway through, and the
+// plan's size is the exact size of the result
+template <typename Key, typename Other, typename GetKey>
+s21::Vector<MergeStep> merge_plan(const s21::Vector<Key>& keys,
+                                  const Other& other, GetKey get_key) {
+  s21::Vector<MergeStep> plan;
+  plan.reserve(keys.size() + other.size());
+  std::size_t i = 0;
+  std::size_t j = 0;
+  while (i < keys.size() || j < other.size()) {
+    if (j == other.size() ||
+        (i < keys.size() && keys[i] < get_key(other[j]))) {
+      plan.push_back(kFirst);
+      ++i;
+    } else if (i == keys.size() || get_key(other[j]) < keys[i]) {
+      plan.push_back(kSecond);
+      ++j;
+    } else {
+      plan.push_back(kBoth);
+      ++i;
+      ++j;
+    }
+  }
+  return plan;
+}
+
+// An element the container still owns, handed to a merge: moved when Move
+// (the caller has checked that moving cannot throw and reserved the
+// result), otherwise copied, so a failed merge leaves the source intact
+template <bool Move, typename Value>
+decltype(auto) take(Value& item) {
+  if constexpr (Move) {
+    return std::move(item);
+  } else {
+    return static_cast<const Value&>(item);
+  }
+}
+
+}  // namespace flat_detail
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SEARCH_H_
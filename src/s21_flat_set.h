@@ -0,0 +1,176 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "s21_flat_search.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Упорядоченное множество в отсортированном s21::Vector: поиск двоичный,
+// обход идет подряд по памяти, вставка и удаление одного элемента - O(n).
+// Подходит для данных, которые строятся один раз и потом много читаются;
+// строить лучше пакетом через конструктор из диапазона или
+// insert(first, last). Интерфейс повторяет s21::Set
+template <typename Key>
+class FlatSet {
+ public:
+  // Типы
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  // Элементы множества менять нельзя, поэтому оба итератора константные;
+  // итератор - указатель в непрерывный массив
+  using iterator = const Key*;
+  using const_iterator = const Key*;
+
+  // Конструкторы
+  FlatSet() = default;
+  FlatSet(std::initializer_list<value_type> const& items) {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt>
+  FlatSet(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+  FlatSet(const FlatSet& other) = default;
+  FlatSet(FlatSet&& other) = default;
+  ~FlatSet() = default;
+
+  // Операторы
+  FlatSet& operator=(const FlatSet& other) = default;
+  FlatSet& operator=(FlatSet&& other) = default;
+
+  // Итераторы
+  iterator begin() const { return keys_.data(); }
+  iterator end() const { return keys_.data() + keys_.size(); }
+
+  // Вместимость
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const { return keys_.max_size(); }
+  void reserve(size_type count) { keys_.reserve(count); }
+
+  // Модификаторы
+  void clear() { keys_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value);
+  // Пакетная вставка: сортировка новых ключей и одно слияние за
+  // O(n + k log k) вместо k сдвигов массива
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  void erase(iterator pos) { keys_.erase(keys_.begin() + (pos - begin())); }
+  size_type erase(const key_type& key);
+  void swap(FlatSet& other) { keys_.swap(other.keys_); }
+  // Элементы, уже присутствующие в текущем множестве, остаются в other
+  void merge(FlatSet& other);
+
+  // Поиск
+  iterator find(const key_type& key) const;
+  bool contains(const key_type& key) const { return find(key) != end(); }
+  iterator lower_bound(const key_type& key) const {
+    return begin() +
+           flat_detail::lower_bound_index(keys_.data(), keys_.size(), key);
+  }
+  iterator upper_bound(const key_type& key) const {
+    return begin() +
+           flat_detail::upper_bound_index(keys_.data(), keys_.size(), key);
+  }
+  std::pair<iterator, iterator> equal_range(const key_type& key) const {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+ private:
+  // Свои ключи при слиянии переносятся, только если перенос не бросает;
+  // иначе копируются, чтобы неудачное слияние не испортило множество
+  static decltype(auto) take(Key& key) {
+    return flat_detail::take<
+        std::is_nothrow_move_constructible<Key>::value>(key);
+  }
+
+  s21::Vector<Key> keys_;
+};
+
+template <typename Key>
+std::pair<typename FlatSet<Key>::iterator, bool> FlatSet<Key>::insert(
+    const value_type& value) {
+  const size_type index =
+      flat_detail::lower_bound_index(keys_.data(), keys_.size(), value);
+  if (index < keys_.size() && !(value < keys_[index])) {
+    return {begin() + index, false};
+  }
+  keys_.insert(keys_.begin() + index, value);
+  return {begin() + index, true};
+}
+
+template <typename Key>
+template <typename InputIt>
+void FlatSet<Key>::insert(InputIt first, InputIt last) {
+  s21::Vector<Key> batch;
+  for (; first != last; ++first) batch.push_back(*first);
+  auto identity = [](const Key& key) -> const Key& { return key; };
+  flat_detail::sort_unique(batch, identity);
+  const auto plan = flat_detail::merge_plan(keys_, batch, identity);
+  s21::Vector<Key> merged;
+  merged.reserve(plan.size());
+  size_type i = 0;
+  size_type j = 0;
+  for (flat_detail::MergeStep step : plan) {
+    if (step == flat_detail::kSecond) {
+      merged.push_back(std::move(batch[j++]));
+    } else {  // При равных остается прежний ключ
+      merged.push_back(take(keys_[i++]));
+      if (step == flat_detail::kBoth) ++j;
+    }
+  }
+  keys_.swap(merged);
+}
+
+template <typename Key>
+typename FlatSet<Key>::size_type FlatSet<Key>::erase(const key_type& key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+  erase(pos);
+  return 1;
+}
+
+template <typename Key>
+void FlatSet<Key>::merge(FlatSet& other) {
+  if (this == &other) return;
+  s21::Vector<Key>& theirs = other.keys_;
+  auto identity = [](const Key& key) -> const Key& { return key; };
+  const auto plan = flat_detail::merge_plan(keys_, theirs, identity);
+  s21::Vector<Key> merged;
+  s21::Vector<Key> rest;
+  merged.reserve(plan.size());
+  rest.reserve(keys_.size() + theirs.size() - plan.size());
+  size_type i = 0;
+  size_type j = 0;
+  for (flat_detail::MergeStep step : plan) {
+    if (step == flat_detail::kFirst) {
+      merged.push_back(take(keys_[i++]));
+    } else if (step == flat_detail::kSecond) {
+      merged.push_back(take(theirs[j++]));
+    } else {
+      merged.push_back(take(keys_[i++]));
+      rest.push_back(take(theirs[j++]));
+    }
+  }
+  keys_.swap(merged);
+  theirs.swap(rest);
+}
+
+template <typename Key>
+typename FlatSet<Key>::iterator FlatSet<Key>::find(const key_type& key) const {
+  const iterator pos = lower_bound(key);
+  return pos != end() && !(key < *pos) ? pos : end();
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H_
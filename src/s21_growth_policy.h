@@ -0,0 +1,58 @@
+#ifndef S21_GROWTH_POLICY_H
+#define S21_GROWTH_POLICY_H
+
+#include <cstddef>
+
+namespace s21 {
+
+// Growth policies decide the capacity a full vector grows to. Every policy
+// provides
+//   static std::size_t next_capacity(std::size_t capacity,
+//                                    std::size_t element_size);
+// which must return a value greater than capacity.
+
+// Doubles the capacity: the fewest reallocations, up to half the buffer
+// unused right after a growth.
+struct GrowDouble {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t) {
+    return capacity > 0 ? 2 * capacity : 1;
+  }
+};
+
+// Grows by half: about 70% more reallocations than doubling (log 2 /
+// log 1.5), but at most a third of the buffer is unused, and after a few
+// steps the freed blocks add up to a size that the allocator can reuse for
+// the next one.
+struct GrowOneAndHalf {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t) {
+    return capacity > 1 ? capacity + capacity / 2 : capacity + 1;
+  }
+};
+
+// Grows by half and then rounds the byte size up to the allocator size
+// class it falls into anyway: 16-byte steps for small blocks, then four
+// classes per power of two as in jemalloc and tcmalloc. The space the
+// allocator would round away becomes usable capacity.
+struct GrowSizeClass {
+  static constexpr std::size_t kQuantum = 16;
+  static constexpr std::size_t kSmallLimit = 128;
+
+  static std::size_t next_capacity(std::size_t capacity,
+                                   std::size_t element_size) {
+    const std::size_t wanted = GrowOneAndHalf::next_capacity(capacity, 0);
+    const std::size_t bytes = round_to_class(wanted * element_size);
+    return bytes / element_size > wanted ? bytes / element_size : wanted;
+  }
+
+  static std::size_t round_to_class(std::size_t bytes) {
+    if (bytes <= kSmallLimit) return (bytes + kQuantum - 1) & ~(kQuantum - 1);
+    std::size_t power = kSmallLimit;
+    while (power * 2 < bytes) power *= 2;
+    const std::size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_GROWTH_POLICY_H
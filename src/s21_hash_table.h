@@ -0,0 +1,659 @@
+#ifndef S21_HASH_TABLE_H_
+#define S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Open-addressing hash table in the style of Swiss tables, shared by
+// UnorderedMap and UnorderedSet.
+//
+// Every slot has a control byte: kEmpty, kDeleted (tombstone) or, for a
+// full slot, the low 7 bits of the key's hash (H2). Lookups start at the
+// slot picked by the remaining bits (H1) and compare 16 control bytes at a
+// time (one SSE2 instruction when available), touching the slot array only
+// for bytes that match H2. A probe stops at the first group that contains
+// an empty byte. Groups are read unaligned, so the first kGroupWidth
+// control bytes are mirrored after the last one.
+//
+// Values live in one flat slot array. Capacity is a power of two and the
+// table grows when 7/8 of the slots are full or deleted.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class HashTable {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  template <typename Item>
+  class HashTableIterator;
+  using iterator = HashTableIterator<Value>;
+  using const_iterator = HashTableIterator<const Value>;
+
+  HashTable();
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other) noexcept;
+  ~HashTable();
+
+  HashTable& operator=(const HashTable& other);
+  HashTable& operator=(HashTable&& other) noexcept;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type bucket_count() const;
+  void reserve(size_type count);
+
+  void clear();
+  // Constructs a Value from args only if key is not present yet; the
+  // table is probed once either way.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_unique(const Key& key, Args&&... args);
+  void erase(const_iterator pos);
+  size_type erase(const Key& key);
+  void swap(HashTable& other) noexcept;
+
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+
+ private:
+  using ctrl_t = std::int8_t;
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr ctrl_t kDeleted = -2;
+  static constexpr size_type kGroupWidth = 16;
+  static constexpr size_type kMinCapacity = 16;
+  static constexpr size_type kNotFound = std::numeric_limits<size_type>::max();
+
+  // 16 control bytes matched at once; bit i of a mask is byte i
+  struct Group {
+#ifdef __SSE2__
+    explicit Group(const ctrl_t* pos)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+    std::uint32_t match(ctrl_t h2) const {
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+    }
+    std::uint32_t match_empty_or_deleted() const {
+      return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+    }
+    __m128i ctrl;
+#else
+    explicit Group(const ctrl_t* pos) { std::memcpy(ctrl, pos, kGroupWidth); }
+    std::uint32_t match(ctrl_t h2) const {
+      std::uint32_t mask = 0;
+      for (size_type i = 0; i < kGroupWidth; ++i)
+        if (ctrl[i] == h2) mask |= 1u << i;
+      return mask;
+    }
+    std::uint32_t match_empty_or_deleted() const {
+      std::uint32_t mask = 0;
+      for (size_type i = 0; i < kGroupWidth; ++i)
+        if (ctrl[i] < -1) mask |= 1u << i;
+      return mask;
+    }
+    ctrl_t ctrl[kGroupWidth];
+#endif
+    std::uint32_t match_empty() const { return match(kEmpty); }
+  };
+
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<Value>::value;
+
+  ctrl_t* ctrl_;
+  Value* slots_;
+  size_type capacity_;     // Zero or a power of two >= kMinCapacity
+  size_type size_;         // Full slots
+  size_type growth_left_;  // Empty slots that may still be filled
+  Hash hash_;
+  KeyEqual equal_;
+
+  static size_type mix(size_type hash);
+  static size_type max_load(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+  static bool is_full(ctrl_t ctrl) { return ctrl >= 0; }
+
+  void set_ctrl(size_type index, ctrl_t value);
+  size_type find_index(const Key& key) const;
+  size_type find_index(const Key& key, size_type hash) const;
+  size_type find_first_non_full(size_type hash) const;
+  size_type skip_empty(size_type index) const;
+  void resize(size_type new_capacity);
+  void drop_deleted();
+  void relocate_slot(Value* from, Value* to);
+  void rehash_for_insert();
+  void destroy_slots();
+  void deallocate();
+};
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename Item>
+class HashTable<Value, Key, KeyOf, Hash, KeyEqual>::HashTableIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename HashTable::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Item*;
+  using reference = Item&;
+  using table_pointer = std::conditional_t<std::is_const<Item>::value,
+                                           const HashTable*, HashTable*>;
+
+  HashTableIterator(table_pointer table = nullptr, size_type index = 0)
+      : table_(table), index_(index) {}
+  // iterator converts to const_iterator
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same<const Other, Item>::value &&
+                                !std::is_same<Other, Item>::value>>
+  HashTableIterator(const HashTableIterator<Other>& other)
+      : table_(other.table_), index_(other.index_) {}
+
+  reference operator*() const { return table_->slots_[index_]; }
+  pointer operator->() const { return &table_->slots_[index_]; }
+
+  HashTableIterator& operator++() {
+    index_ = table_->skip_empty(index_ + 1);
+    return *this;
+  }
+  HashTableIterator operator++(int) {
+    HashTableIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  bool operator==(const HashTableIterator& other) const {
+    return index_ == other.index_ && table_ == other.table_;
+  }
+  bool operator!=(const HashTableIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class HashTable;
+  template <typename Other>
+  friend class HashTableIterator;
+
+  table_pointer table_;
+  size_type index_;
+};
+
+// Constructors and assignment
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::HashTable()
+    : ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0) {}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::HashTable(const HashTable& other)
+    : HashTable() {
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  reserve(other.size_);
+  for (const auto& value : other) {
+    emplace_unique(KeyOf()(value), value);
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::HashTable(
+    HashTable&& other) noexcept : HashTable() {
+  swap(other);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::~HashTable() {
+  destroy_slots();
+  deallocate();
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>&
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::operator=(
+    const HashTable& other) {
+  if (this != &other) {
+    HashTable copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>&
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::operator=(
+    HashTable&& other) noexcept {
+  if (this != &other) {
+    HashTable moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+// Iterators
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::begin() {
+  return iterator(this, skip_empty(0));
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::end() {
+  return iterator(this, capacity_);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::begin() const {
+  return const_iterator(this, skip_empty(0));
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::end() const {
+  return const_iterator(this, capacity_);
+}
+
+// Capacity
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+bool HashTable<Value, Key, KeyOf, Hash, KeyEqual>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size() const {
+  return size_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::max_size() const {
+  return std::numeric_limits<size_type>::max() / 2 / (sizeof(Value) + 1);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::bucket_count() const {
+  return capacity_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::reserve(size_type count) {
+  size_type new_capacity = capacity_ > 0 ? capacity_ : kMinCapacity;
+  while (max_load(new_capacity) < count) new_capacity *= 2;
+  if (new_capacity > capacity_) resize(new_capacity);
+}
+
+// Modifiers
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::clear() {
+  destroy_slots();
+  if (capacity_ > 0) {
+    std::memset(ctrl_, kEmpty, capacity_ + kGroupWidth);
+  }
+  size_ = 0;
+  growth_left_ = max_load(capacity_);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename... Args>
+std::pair<typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::iterator, bool>
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::emplace_unique(
+    const Key& key, Args&&... args) {
+  const size_type hash = mix(hash_(key));
+  size_type found = find_index(key, hash);
+  if (found != kNotFound) {
+    return std::make_pair(iterator(this, found), false);
+  }
+  size_type index = capacity_ > 0 ? find_first_non_full(hash) : kNotFound;
+  if (index == kNotFound || (growth_left_ == 0 && ctrl_[index] != kDeleted)) {
+    // Built before the rehash: args may refer to a value it relocates
+    Value value(std::forward<Args>(args)...);
+    rehash_for_insert();
+    index = find_first_non_full(hash);
+    ::new (static_cast<void*>(slots_ + index)) Value(std::move(value));
+  } else {
+    ::new (static_cast<void*>(slots_ + index))
+        Value(std::forward<Args>(args)...);
+  }
+  if (ctrl_[index] == kEmpty) --growth_left_;
+  set_ctrl(index, static_cast<ctrl_t>(hash & 0x7F));
+  ++size_;
+  return std::make_pair(iterator(this, index), true);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::erase(const_iterator pos) {
+  const size_type index = pos.index_;
+  if (index >= capacity_) return;
+  slots_[index].~Value();
+  --size_;
+  // The slot may become empty again unless some probe could have walked
+  // past it, i.e. unless it sits inside kGroupWidth consecutive non-empty
+  // slots. Otherwise leave a tombstone so such probes keep going.
+  const size_type before = (index - kGroupWidth) & (capacity_ - 1);
+  const std::uint32_t empty_after = Group(ctrl_ + index).match_empty();
+  const std::uint32_t empty_before = Group(ctrl_ + before).match_empty();
+  const bool was_never_full =
+      empty_before && empty_after &&
+      static_cast<size_type>(__builtin_ctz(empty_after) +
+                             __builtin_clz(empty_before) - 16) < kGroupWidth;
+  set_ctrl(index, was_never_full ? kEmpty : kDeleted);
+  if (was_never_full) ++growth_left_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::erase(const Key& key) {
+  size_type index = find_index(key);
+  if (index == kNotFound) return 0;
+  erase(const_iterator(this, index));
+  return 1;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::swap(HashTable& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+// Lookup
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::find(const Key& key) {
+  size_type index = find_index(key);
+  return index == kNotFound ? end() : iterator(this, index);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::const_iterator
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::find(
+    const Key& key) const {
+  size_type index = find_index(key);
+  return index == kNotFound ? end() : const_iterator(this, index);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+bool
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::contains(const Key& key) const {
+  return find_index(key) != kNotFound;
+}
+
+// Private helpers
+
+// Spreads the bits of weak hashes (std::hash<int> is the identity) so that
+// both H1 and H2 are usable.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::mix(size_type hash) {
+  std::uint64_t x = hash;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  return static_cast<size_type>(x);
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::set_ctrl(
+    size_type index, ctrl_t value) {
+  ctrl_[index] = value;
+  if (index < kGroupWidth) ctrl_[capacity_ + index] = value;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::find_index(const Key& key) const {
+  return capacity_ > 0 ? find_index(key, mix(hash_(key))) : kNotFound;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::find_index(
+    const Key& key, size_type hash) const {
+  if (capacity_ == 0) return kNotFound;
+  const ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7F);
+  const size_type mask = capacity_ - 1;
+  size_type pos = (hash >> 7) & mask;
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    Group group(ctrl_ + pos);
+    for (std::uint32_t match = group.match(h2); match; match &= match - 1) {
+      size_type index = (pos + __builtin_ctz(match)) & mask;
+      if (equal_(KeyOf()(slots_[index]), key)) return index;
+    }
+    if (group.match_empty()) return kNotFound;
+    pos = (pos + step) & mask;
+  }
+}
+
+// First empty or deleted slot on the probe sequence of hash
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::find_first_non_full(
+    size_type hash) const {
+  const size_type mask = capacity_ - 1;
+  size_type pos = (hash >> 7) & mask;
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    std::uint32_t mask_free = Group(ctrl_ + pos).match_empty_or_deleted();
+    if (mask_free) return (pos + __builtin_ctz(mask_free)) & mask;
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename HashTable<Value, Key, KeyOf, Hash, KeyEqual>::size_type
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::skip_empty(
+    size_type index) const {
+  while (index < capacity_ && !is_full(ctrl_[index])) ++index;
+  return index;
+}
+
+// Moves every value into fresh arrays of new_capacity slots; tombstones
+// are dropped on the way. The new arrays are filled as a separate table
+// and swapped in only at the end. Values whose move may throw are copied,
+// so a throw leaves this table as it was and the partial copy is destroyed
+// with the local table.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void
+HashTable<Value, Key, KeyOf, Hash, KeyEqual>::resize(size_type new_capacity) {
+  HashTable table;
+  void* memory = ::operator new(new_capacity + kGroupWidth);
+  try {
+    table.slots_ = std::allocator<Value>().allocate(new_capacity);
+  } catch (...) {
+    ::operator delete(memory);
+    throw;
+  }
+  table.ctrl_ = static_cast<ctrl_t*>(memory);
+  table.capacity_ = new_capacity;
+  std::memset(table.ctrl_, kEmpty, new_capacity + kGroupWidth);
+
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (!is_full(ctrl_[i])) continue;
+    size_type hash = mix(hash_(KeyOf()(slots_[i])));
+    size_type index = table.find_first_non_full(hash);
+    if constexpr (kTriviallyRelocatable) {
+      std::memcpy(static_cast<void*>(table.slots_ + index), slots_ + i,
+                  sizeof(Value));
+    } else {
+      ::new (static_cast<void*>(table.slots_ + index))
+          Value(std::move_if_noexcept(slots_[i]));
+    }
+    table.set_ctrl(index, static_cast<ctrl_t>(hash & 0x7F));
+    ++table.size_;
+  }
+  table.growth_left_ = max_load(new_capacity) - size_;
+  // The old arrays leave with the local table, which destroys the
+  // moved-from or copied values and frees them
+  std::swap(ctrl_, table.ctrl_);
+  std::swap(slots_, table.slots_);
+  std::swap(capacity_, table.capacity_);
+  std::swap(growth_left_, table.growth_left_);
+}
+
+// Purges tombstones without a second array. Tombstones become empty and
+// full slots are marked kDeleted, meaning "not placed yet". Each marked
+// value then goes to the first free slot of its probe sequence: it stays
+// put if that slot is in its own group, moves if the slot is empty, and
+// trades places with the other unplaced value otherwise, which is then
+// placed in turn.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::drop_deleted() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    ctrl_[i] = is_full(ctrl_[i]) ? kDeleted : kEmpty;
+  }
+  std::memcpy(ctrl_ + capacity_, ctrl_, kGroupWidth);
+  const size_type mask = capacity_ - 1;
+  alignas(Value) unsigned char buffer[sizeof(Value)];
+  Value* spare = reinterpret_cast<Value*>(buffer);
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] != kDeleted) continue;
+    const size_type hash = mix(hash_(KeyOf()(slots_[i])));
+    const ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7F);
+    const size_type start = (hash >> 7) & mask;
+    const size_type target = find_first_non_full(hash);
+    if (((i - start) & mask) / kGroupWidth ==
+        ((target - start) & mask) / kGroupWidth) {
+      set_ctrl(i, h2);
+    } else if (ctrl_[target] == kEmpty) {
+      relocate_slot(slots_ + i, slots_ + target);
+      set_ctrl(target, h2);
+      set_ctrl(i, kEmpty);
+    } else {
+      relocate_slot(slots_ + target, spare);
+      relocate_slot(slots_ + i, slots_ + target);
+      relocate_slot(spare, slots_ + i);
+      set_ctrl(target, h2);
+      --i;
+    }
+  }
+  growth_left_ = max_load(capacity_) - size_;
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::relocate_slot(Value* from,
+                                                                 Value* to) {
+  if constexpr (kTriviallyRelocatable) {
+    std::memcpy(static_cast<void*>(to), from, sizeof(Value));
+  } else {
+    ::new (static_cast<void*>(to)) Value(std::move(*from));
+    from->~Value();
+  }
+}
+
+// Makes room for one more value: doubles the table, or only purges
+// tombstones when they, not live values, used up the growth budget. The
+// purge runs in place when moving a value cannot throw: a throw halfway
+// through would strand values that lookups no longer reach. Other values
+// are copied by resize into new arrays of the same capacity, which keeps
+// the table intact if a copy throws.
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::rehash_for_insert() {
+  if (capacity_ == 0) {
+    resize(kMinCapacity);
+  } else if (size_ * 32 <= capacity_ * 25) {
+    if constexpr (kTriviallyRelocatable ||
+                  std::is_nothrow_move_constructible<Value>::value) {
+      drop_deleted();
+    } else {
+      resize(capacity_);
+    }
+  } else {
+    resize(capacity_ * 2);
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::destroy_slots() {
+  if constexpr (!std::is_trivially_destructible<Value>::value) {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (is_full(ctrl_[i])) slots_[i].~Value();
+    }
+  }
+}
+
+template <typename Value, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void HashTable<Value, Key, KeyOf, Hash, KeyEqual>::deallocate() {
+  if (ctrl_) {
+    ::operator delete(ctrl_);
+    std::allocator<Value>().deallocate(slots_, capacity_);
+  }
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  growth_left_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // S21_HASH_TABLE_H_
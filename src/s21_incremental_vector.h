@@ -0,0 +1,536 @@
+#ifndef S21_INCREMENTAL_VECTOR_H
+#define S21_INCREMENTAL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+
+namespace s21 {
+
+// Vector whose growth never moves all elements at once. When a full buffer
+// grows, the new one is allocated and the elements stay where they are;
+// every following push_back moves a few of them from the old buffer, just
+// enough to finish before the new buffer fills up. A single push_back is
+// thus bounded by one allocation and a fixed number of element moves
+// instead of a copy of the whole vector (see kEagerBytes for small ones).
+//
+// The price: while a migration is pending the elements live in two
+// buffers, so operator[] checks which one holds the index and iterators
+// are index-based rather than T*. data() and reserve() finish a pending
+// migration first and are the only calls with an unbounded cost.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Growth = GrowDouble>
+class IncrementalVector {
+  template <bool Const>
+  class IncrementalVectorIterator;
+
+ public:
+  // Member types
+  using allocator_type = Allocator;
+  using growth_policy = Growth;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = IncrementalVectorIterator<false>;
+  using const_iterator = IncrementalVectorIterator<true>;
+  using size_type = std::size_t;
+
+  // Buffers up to this size are still migrated in one go: copying them
+  // costs about as much as the allocation itself
+  static constexpr size_type kEagerBytes = size_type{64} << 10;
+
+  // Constructors
+  IncrementalVector();
+  explicit IncrementalVector(const allocator_type& alloc);
+  IncrementalVector(const IncrementalVector& v);
+  IncrementalVector(const IncrementalVector& v, const allocator_type& alloc);
+  IncrementalVector(IncrementalVector&& v);
+  IncrementalVector(IncrementalVector&& v, const allocator_type& alloc);
+  ~IncrementalVector();
+
+  // Operator=
+  IncrementalVector& operator=(const IncrementalVector& v);
+  IncrementalVector& operator=(IncrementalVector&& v);
+
+  // Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos) { return *slot(pos); }
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+  const_reference front() const { return *slot(0); }
+  const_reference back() const { return *slot(size_ - 1); }
+  // Contiguous storage; finishes a pending migration
+  T* data();
+  allocator_type get_allocator() const { return alloc_; }
+
+  // Iterators
+  iterator begin() { return iterator(this, 0); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator end() const { return const_iterator(this, size_); }
+
+  // Capacity
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const { return capacity_; }
+  // True while part of the elements still lives in the old buffer
+  bool is_growing() const { return old_ != nullptr; }
+  void finish_growth();
+
+  // Modifiers
+  void clear();
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(IncrementalVector& other);
+
+ private:
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<T>::value;
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  [[no_unique_address]] Allocator alloc_;
+  T* data_;
+  size_type size_;
+  size_type capacity_;
+  // Pending migration: indices [migrated_, old_end_) are still in old_
+  T* old_;
+  size_type old_capacity_;
+  size_type migrated_;
+  size_type old_end_;
+  size_type step_;
+
+  T* slot(size_type pos) const {
+    return pos >= migrated_ && pos < old_end_ ? old_ + pos : data_ + pos;
+  }
+  bool in_old(const T* p) const {
+    return old_ && !std::less<const T*>()(p, old_) &&
+           std::less<const T*>()(p, old_ + old_end_);
+  }
+  void grow();
+  void migrate(size_type count);
+  void release_old();
+  void steal(IncrementalVector& v);
+
+  T* allocate(size_type n);
+  void deallocate(T* ptr, size_type n);
+  void relocate(T* first, T* last, T* dest);
+  void destroy_all();
+};
+
+// Random access over indices of the vector
+template <typename T, typename A, typename G>
+template <bool Const>
+class IncrementalVector<T, A, G>::IncrementalVectorIterator {
+  using Owner = std::conditional_t<Const, const IncrementalVector,
+                                   IncrementalVector>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T*, T*>;
+  using reference = std::conditional_t<Const, const T&, T&>;
+
+  IncrementalVectorIterator() : owner_(nullptr), index_(0) {}
+  IncrementalVectorIterator(Owner* owner, size_type index)
+      : owner_(owner), index_(index) {}
+  // iterator -> const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<Const && !OtherConst>>
+  IncrementalVectorIterator(const IncrementalVectorIterator<OtherConst>& it)
+      : owner_(it.owner_), index_(it.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+  pointer operator->() const { return &(*owner_)[index_]; }
+  reference operator[](difference_type n) const {
+    return (*owner_)[index_ + n];
+  }
+
+  IncrementalVectorIterator& operator++() {
+    ++index_;
+    return *this;
+  }
+  IncrementalVectorIterator operator++(int) {
+    IncrementalVectorIterator old = *this;
+    ++index_;
+    return old;
+  }
+  IncrementalVectorIterator& operator--() {
+    --index_;
+    return *this;
+  }
+  IncrementalVectorIterator operator--(int) {
+    IncrementalVectorIterator old = *this;
+    --index_;
+    return old;
+  }
+  IncrementalVectorIterator& operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+  IncrementalVectorIterator& operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  friend IncrementalVectorIterator operator+(IncrementalVectorIterator it,
+                                             difference_type n) {
+    return it += n;
+  }
+  friend IncrementalVectorIterator operator+(difference_type n,
+                                             IncrementalVectorIterator it) {
+    return it += n;
+  }
+  friend IncrementalVectorIterator operator-(IncrementalVectorIterator it,
+                                             difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const IncrementalVectorIterator& a,
+                                   const IncrementalVectorIterator& b) {
+    return static_cast<difference_type>(a.index_) -
+           static_cast<difference_type>(b.index_);
+  }
+  friend bool operator==(const IncrementalVectorIterator& a,
+                         const IncrementalVectorIterator& b) {
+    return a.index_ == b.index_;
+  }
+  friend bool operator!=(const IncrementalVectorIterator& a,
+                         const IncrementalVectorIterator& b) {
+    return a.index_ != b.index_;
+  }
+  friend bool operator<(const IncrementalVectorIterator& a,
+                        const IncrementalVectorIterator& b) {
+    return a.index_ < b.index_;
+  }
+  friend bool operator>(const IncrementalVectorIterator& a,
+                        const IncrementalVectorIterator& b) {
+    return b < a;
+  }
+  friend bool operator<=(const IncrementalVectorIterator& a,
+                         const IncrementalVectorIterator& b) {
+    return !(b < a);
+  }
+  friend bool operator>=(const IncrementalVectorIterator& a,
+                         const IncrementalVectorIterator& b) {
+    return !(a < b);
+  }
+
+ private:
+  template <bool>
+  friend class IncrementalVectorIterator;
+
+  Owner* owner_;
+  size_type index_;
+};
+
+// Implementations
+
+// Constructors
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector()
+    : IncrementalVector(allocator_type()) {}
+
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector(const allocator_type& alloc)
+    : alloc_(alloc),
+      data_(nullptr),
+      size_(0),
+      capacity_(0),
+      old_(nullptr),
+      old_capacity_(0),
+      migrated_(0),
+      old_end_(0),
+      step_(0) {}
+
+// The copy is contiguous whatever state v is in
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector(const IncrementalVector& v)
+    : IncrementalVector(
+          v, AllocTraits::select_on_container_copy_construction(v.alloc_)) {}
+
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector(const IncrementalVector& v,
+                                              const allocator_type& alloc)
+    : IncrementalVector(alloc) {
+  if (v.size_ == 0) return;
+  data_ = allocate(v.size_);
+  capacity_ = v.size_;
+  try {
+    for (; size_ < v.size_; ++size_) {
+      AllocTraits::construct(alloc_, data_ + size_, v[size_]);
+    }
+  } catch (...) {
+    destroy_all();
+    deallocate(data_, capacity_);
+    throw;
+  }
+}
+
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector(IncrementalVector&& v)
+    : IncrementalVector(v.alloc_) {
+  steal(v);
+}
+
+// Takes over v's buffers when the allocators are equal; otherwise the
+// elements are moved one by one into storage from alloc.
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::IncrementalVector(IncrementalVector&& v,
+                                              const allocator_type& alloc)
+    : IncrementalVector(alloc) {
+  if (alloc_ == v.alloc_) {
+    steal(v);
+    return;
+  }
+  if (v.size_ == 0) return;
+  data_ = allocate(v.size_);
+  capacity_ = v.size_;
+  try {
+    for (; size_ < v.size_; ++size_) {
+      AllocTraits::construct(alloc_, data_ + size_,
+                             std::move_if_noexcept(v[size_]));
+    }
+  } catch (...) {
+    destroy_all();
+    deallocate(data_, capacity_);
+    throw;
+  }
+  v.clear();
+}
+
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>::~IncrementalVector() {
+  clear();
+  if (data_) deallocate(data_, capacity_);
+}
+
+// Operator=
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>& IncrementalVector<T, A, G>::operator=(
+    const IncrementalVector& v) {
+  if (this != &v) {
+    IncrementalVector copy(v, alloc_);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, typename A, typename G>
+IncrementalVector<T, A, G>& IncrementalVector<T, A, G>::operator=(
+    IncrementalVector&& v) {
+  if (this != &v) {
+    IncrementalVector moved(std::move(v), alloc_);
+    swap(moved);
+  }
+  return *this;
+}
+
+// Element access
+template <typename T, typename A, typename G>
+typename IncrementalVector<T, A, G>::reference IncrementalVector<T, A, G>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("IncrementalVector::at: index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T, typename A, typename G>
+T* IncrementalVector<T, A, G>::data() {
+  finish_growth();
+  return data_;
+}
+
+// Capacity
+template <typename T, typename A, typename G>
+typename IncrementalVector<T, A, G>::size_type
+IncrementalVector<T, A, G>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+// An explicit reserve moves everything at once, like Vector::reserve
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::reserve(size_type new_capacity) {
+  if (new_capacity <= capacity_) return;
+  finish_growth();
+  T* new_data = allocate(new_capacity);
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    deallocate(new_data, new_capacity);
+    throw;
+  }
+  if (data_) deallocate(data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::finish_growth() {
+  if (old_) migrate(old_end_ - migrated_);
+}
+
+// Modifiers
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::clear() {
+  destroy_all();
+  release_old();
+  size_ = 0;
+}
+
+// Growth itself only allocates; the step of migration that precedes the
+// insertion is what moves elements. Running it before the new element is
+// constructed keeps the size unchanged if a relocation throws
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::push_back(const_reference value) {
+  if (size_ == capacity_ || in_old(&value)) {
+    // Copied first: value may refer to an element that is about to move
+    T copy(value);
+    if (size_ == capacity_) grow();
+    if (old_) migrate(step_);
+    AllocTraits::construct(alloc_, data_ + size_, std::move(copy));
+  } else {
+    if (old_) migrate(step_);
+    AllocTraits::construct(alloc_, data_ + size_, value);
+  }
+  ++size_;
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::pop_back() {
+  if (size_ == 0) return;
+  AllocTraits::destroy(alloc_, slot(size_ - 1));
+  --size_;
+  if (old_ && size_ < old_end_) {
+    old_end_ = size_;
+    if (migrated_ >= old_end_) release_old();
+  }
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::swap(IncrementalVector& other) {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(old_, other.old_);
+  std::swap(old_capacity_, other.old_capacity_);
+  std::swap(migrated_, other.migrated_);
+  std::swap(old_end_, other.old_end_);
+  std::swap(step_, other.step_);
+}
+
+// Private member functions
+
+// The step is the smallest number of moves per push_back that empties the
+// old buffer before the new one is full, so a growth never has to wait
+// for the previous migration.
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::grow() {
+  finish_growth();
+  const size_type new_capacity = G::next_capacity(capacity_, sizeof(T));
+  T* new_data = allocate(new_capacity);
+  if (size_ * sizeof(T) <= kEagerBytes) {
+    try {
+      relocate(data_, data_ + size_, new_data);
+    } catch (...) {
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    if (data_) deallocate(data_, capacity_);
+  } else {
+    old_ = data_;
+    old_capacity_ = capacity_;
+    migrated_ = 0;
+    old_end_ = size_;
+    const size_type free_slots = new_capacity - size_;
+    step_ = (size_ + free_slots - 1) / free_slots;
+  }
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::migrate(size_type count) {
+  const size_type end = std::min(old_end_, migrated_ + count);
+  relocate(old_ + migrated_, old_ + end, data_ + migrated_);
+  migrated_ = end;
+  if (migrated_ == old_end_) release_old();
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::release_old() {
+  if (old_) deallocate(old_, old_capacity_);
+  old_ = nullptr;
+  old_capacity_ = 0;
+  migrated_ = 0;
+  old_end_ = 0;
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::steal(IncrementalVector& v) {
+  data_ = std::exchange(v.data_, nullptr);
+  size_ = std::exchange(v.size_, 0);
+  capacity_ = std::exchange(v.capacity_, 0);
+  old_ = std::exchange(v.old_, nullptr);
+  old_capacity_ = std::exchange(v.old_capacity_, 0);
+  migrated_ = std::exchange(v.migrated_, 0);
+  old_end_ = std::exchange(v.old_end_, 0);
+  step_ = std::exchange(v.step_, 0);
+}
+
+template <typename T, typename A, typename G>
+T* IncrementalVector<T, A, G>::allocate(size_type n) {
+  return AllocTraits::allocate(alloc_, n);
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::deallocate(T* ptr, size_type n) {
+  AllocTraits::deallocate(alloc_, ptr, n);
+}
+
+// Moves [first, last) into uninitialized dest and ends the lifetime of the
+// source objects. Trivially copyable types are copied as one block.
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::relocate(T* first, T* last, T* dest) {
+  if constexpr (kTriviallyRelocatable) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+    }
+  } else {
+    T* current = dest;
+    try {
+      for (T* it = first; it != last; ++it, ++current) {
+        AllocTraits::construct(alloc_, current, std::move_if_noexcept(*it));
+      }
+    } catch (...) {
+      for (T* it = dest; it != current; ++it) AllocTraits::destroy(alloc_, it);
+      throw;
+    }
+    for (; first != last; ++first) AllocTraits::destroy(alloc_, first);
+  }
+}
+
+template <typename T, typename A, typename G>
+void IncrementalVector<T, A, G>::destroy_all() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 0; i < size_; ++i) AllocTraits::destroy(alloc_, slot(i));
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_INCREMENTAL_VECTOR_H
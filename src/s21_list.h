@@ -1,7 +1,12 @@
 #ifndef Containers_List_H
 #define Containers_List_H
+#include <functional>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_node_allocator.h"
 
 namespace s21 {
 
@@ -10,7 +15,7 @@ class ListIterator {
  public:
   using value_type = typename MyList::value_type;
 
-  template <class T>
+  template <class T, template <class> class NodeAllocator>
   friend class List;
   inline ListIterator<MyList>& operator++();
   inline ListIterator<MyList> operator++(int);
@@ -94,7 +99,7 @@ ListIterator<MyList>::ListIterator(ListEntry* node, ListEntry* head) {
 template <class MyList>
 class ConstListIterator : public ListIterator<MyList> {
  public:
-  template <class T>
+  template <class T, template <class> class NodeAllocator>
   friend class List;
 
   inline const typename MyList::value_type& operator*() const;
@@ -103,6 +108,9 @@ class ConstListIterator : public ListIterator<MyList> {
   inline ConstListIterator<MyList>& operator--();
   inline ConstListIterator<MyList> operator--(int);
 
+  ConstListIterator(const ListIterator<MyList>& it)
+      : ListIterator<MyList>(it) {}
+
  private:
   ConstListIterator(typename ListIterator<MyList>::ListEntry* node,
                     typename ListIterator<MyList>::ListEntry* head)
@@ -187,7 +195,7 @@ inline ReverseListIterator<MyList> ReverseListIterator<MyList>::operator--(
 template <class MyList>
 class ConstReverseListIterator : public ReverseListIterator<MyList> {
  public:
-  template <class T>
+  template <class T, template <class> class NodeAllocator>
   friend class List;
 
   inline const typename MyList::value_type& operator*() const;
@@ -238,19 +246,31 @@ ConstReverseListIterator<MyList>::operator--(int) {
   return old;
 }
 
-template <class T>
+// NodeAllocator is a node allocation policy from s21_node_allocator.h:
+// NewNodeAllocator (one new/delete per node), PoolNodeAllocator (slabs
+// with a freelist, released in bulk on clear()) or PmrNodeAllocator (nodes
+// from a std::pmr::memory_resource passed to the constructor).
+template <class T, template <class> class NodeAllocator = NewNodeAllocator>
 class List {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
-  using iterator = ListIterator<List<T>>;
-  using const_iterator = ConstListIterator<List<T>>;
-  using reverse_iterator = ReverseListIterator<List<T>>;
-  using const_reverse_iterator = ConstReverseListIterator<List<T>>;
+  using iterator = ListIterator<List>;
+  using const_iterator = ConstListIterator<List>;
+  using reverse_iterator = ReverseListIterator<List>;
+  using const_reverse_iterator = ConstReverseListIterator<List>;
   using size_type = size_t;
+  using node_allocator_type = NodeAllocator<typename iterator::ListEntry>;
+  using allocator_type = node_allocator_type;
 
   List();
+  // Constructs the node allocator from resource, e.g. a
+  // std::pmr::memory_resource* for PmrNodeAllocator
+  template <class Resource,
+            class = std::enable_if_t<
+                std::is_constructible<node_allocator_type, Resource>::value>>
+  explicit List(Resource&& resource);
   explicit List(size_type n);
   List(std::initializer_list<T> const& list);
   List(const List& l);
@@ -275,11 +295,20 @@ class List {
   inline size_type max_size() const noexcept;
 
   inline void clear() noexcept;
-  inline iterator insert(iterator pos, const_reference value) noexcept;
+  inline iterator insert(iterator pos, const_reference value);
+  inline iterator insert(iterator pos, T&& value);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
   inline void erase(iterator pos) noexcept;
-  inline void push_back(const T& val) noexcept;
+  inline void push_back(const T& val);
+  inline void push_back(T&& val);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
   inline void pop_back();
-  inline void push_front(const T& val) noexcept;
+  inline void push_front(const T& val);
+  inline void push_front(T&& val);
+  template <class... Args>
+  reference emplace_front(Args&&... args);
   inline void pop_front();
   inline void swap(List& other) noexcept;
   void merge(List& other) noexcept;
@@ -287,50 +316,91 @@ class List {
   inline void reverse() noexcept;
   void unique() noexcept;
   void sort() noexcept;
-
-  inline void assign(const std::initializer_list<T>& el) noexcept;
+  template <class Compare>
+  void sort(Compare comp);
+
+  inline void assign(const std::initializer_list<T>& el);
+
+  // Each argument constructs one node in place, in argument order;
+  // insert_many returns the first new element
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+  template <class... Args>
+  void insert_many_front(Args&&... args);
+
+  inline const node_allocator_type& get_allocator() const noexcept {
+    return allocator_;
+  }
 
  private:
+  using ListEntry = typename iterator::ListEntry;
+
+  inline void createHead();
+  template <class... Args>
+  ListEntry* createNode(Args&&... args);
+  inline void linkBefore(ListEntry* pos, ListEntry* node) noexcept;
+  inline void destroyNode(ListEntry* node) noexcept;
+  template <class Compare>
+  static ListEntry* mergeRuns(ListEntry* left, ListEntry* right,
+                              Compare& comp);
+
   iterator head_;
   size_type size_ = 0;
+  node_allocator_type allocator_;
 };
 
+// Pooled list: nodes come from per-list slabs instead of the heap
 template <class T>
-List<T>::List() {
-  head_.nodePtr_ = new typename ListIterator<List<T>>::ListEntry();
-  head_.nodePtr_->fLink = head_.nodePtr_;
-  head_.nodePtr_->bLink = head_.nodePtr_;
-  head_.headPtr_ = head_.nodePtr_;
-}
+using PooledList = List<T, PoolNodeAllocator>;
 
+namespace pmr {
+// Nodes come from the memory resource given to the constructor
 template <class T>
-List<T>::List(size_type n) : List<T>::List() {
+using List = s21::List<T, PmrNodeAllocator>;
+}  // namespace pmr
+
+template <class T, template <class> class A>
+List<T, A>::List() {
+  createHead();
+}
+
+template <class T, template <class> class A>
+template <class Resource, class>
+List<T, A>::List(Resource&& resource)
+    : allocator_(std::forward<Resource>(resource)) {
+  createHead();
+}
+
+template <class T, template <class> class A>
+List<T, A>::List(size_type n) : List<T, A>::List() {
   for (size_type i = 0; i < n; ++i) push_back(0);
 }
 
-template <class T>
-List<T>::List(std::initializer_list<T> const& el) : List<T>::List() {
+template <class T, template <class> class A>
+List<T, A>::List(std::initializer_list<T> const& el) : List<T, A>::List() {
   assign(el);
 }
 
-template <class T>
-List<T>::List(const List& l) : List<T>::List() {
+template <class T, template <class> class A>
+List<T, A>::List(const List& l) : List<T, A>::List() {
   for (auto it = l.cbegin(); it != l.cend(); ++it) push_back(*it);
 }
 
-template <class T>
-List<T>::List(List&& l) : List<T>::List() {
+template <class T, template <class> class A>
+List<T, A>::List(List&& l) : List<T, A>::List() {
   swap(l);
 }
 
-template <class T>
-List<T>::~List() {
+template <class T, template <class> class A>
+List<T, A>::~List() {
   clear();
   delete head_.nodePtr_;
 }
 
-template <class T>
-List<T>& List<T>::operator=(List&& l) {
+template <class T, template <class> class A>
+List<T, A>& List<T, A>::operator=(List&& l) {
   if (&l != this) {
     clear();
     swap(l);
@@ -338,148 +408,180 @@ List<T>& List<T>::operator=(List&& l) {
   return *this;
 }
 
-template <class T>
-inline typename List<T>::const_reference List<T>::front() const {
+template <class T, template <class> class A>
+inline typename List<T, A>::const_reference List<T, A>::front() const {
   if (empty()) throw(std::runtime_error("front called on empty list"));
   return *cbegin();
 }
 
-template <class T>
-inline typename List<T>::const_reference List<T>::back() const {
+template <class T, template <class> class A>
+inline typename List<T, A>::const_reference List<T, A>::back() const {
   if (empty()) throw(std::runtime_error("front called on empty list"));
   return *(--cend());
 }
 
-template <class T>
-inline typename List<T>::iterator List<T>::begin() noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::iterator List<T, A>::begin() noexcept {
   return iterator(head_.nodePtr_->fLink, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::const_iterator List<T>::cbegin() const noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::const_iterator List<T, A>::cbegin() const noexcept {
   return const_iterator(head_.nodePtr_->fLink, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::reverse_iterator List<T>::rbegin() noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::reverse_iterator List<T, A>::rbegin() noexcept {
   return reverse_iterator(head_.nodePtr_->bLink, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::const_reverse_iterator List<T>::crbegin()
+template <class T, template <class> class A>
+inline typename List<T, A>::const_reverse_iterator List<T, A>::crbegin()
     const noexcept {
   return const_reverse_iterator(head_.nodePtr_->bLink, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::iterator List<T>::end() noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::iterator List<T, A>::end() noexcept {
   return head_;
 }
 
-template <class T>
-inline typename List<T>::const_iterator List<T>::cend() const noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::const_iterator List<T, A>::cend() const noexcept {
   return const_iterator(head_.nodePtr_, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::reverse_iterator List<T>::rend() noexcept {
+template <class T, template <class> class A>
+inline typename List<T, A>::reverse_iterator List<T, A>::rend() noexcept {
   return reverse_iterator(head_.nodePtr_, head_.nodePtr_);
 }
 
-template <class T>
-inline typename List<T>::const_reverse_iterator List<T>::crend()
+template <class T, template <class> class A>
+inline typename List<T, A>::const_reverse_iterator List<T, A>::crend()
     const noexcept {
   return const_reverse_iterator(head_.nodePtr_, head_.nodePtr_);
 }
 
-template <class T>
-inline bool List<T>::empty() const noexcept {
+template <class T, template <class> class A>
+inline bool List<T, A>::empty() const noexcept {
   return size_ == 0;
 }
 
-template <class T>
-inline typename List<T>::size_type List<T>::max_size() const noexcept {
-  return ~0ull / (sizeof(typename ListIterator<List<T>>::ListEntry));
+template <class T, template <class> class A>
+inline typename List<T, A>::size_type List<T, A>::max_size() const noexcept {
+  return ~0ull / (sizeof(typename ListIterator<List<T, A>>::ListEntry));
 }
 
-template <class T>
-inline void List<T>::clear() noexcept {
-  iterator next = begin();
-  while (next != head_) {
-    iterator current = next++;
-    delete current.nodePtr_;
+template <class T, template <class> class A>
+inline void List<T, A>::clear() noexcept {
+  if constexpr (node_allocator_type::kBulkRelease) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      for (ListEntry* node = head_.nodePtr_->fLink; node != head_.nodePtr_;
+           node = node->fLink)
+        node->~ListEntry();
+    }
+    allocator_.release();
+  } else {
+    ListEntry* node = head_.nodePtr_->fLink;
+    while (node != head_.nodePtr_) {
+      ListEntry* next = node->fLink;
+      destroyNode(node);
+      node = next;
+    }
   }
   size_ = 0;
   head_.nodePtr_->fLink = head_.nodePtr_;
   head_.nodePtr_->bLink = head_.nodePtr_;
 }
 
-template <class T>
-inline typename List<T>::iterator List<T>::insert(
-    typename List<T>::iterator pos,
-    typename List<T>::const_reference value) noexcept {
-  auto newNode = new typename iterator::ListEntry();
-  newNode->fLink = pos.nodePtr_;
-  newNode->bLink = pos.nodePtr_->bLink;
-  newNode->entity = value;
-  pos.nodePtr_->bLink->fLink = newNode;
-  pos.nodePtr_->bLink = newNode;
-  ++size_;
+template <class T, template <class> class A>
+inline typename List<T, A>::iterator List<T, A>::insert(
+    typename List<T, A>::iterator pos,
+    typename List<T, A>::const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class T, template <class> class A>
+inline typename List<T, A>::iterator List<T, A>::insert(
+    typename List<T, A>::iterator pos, T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+// The element is constructed directly in the new node
+template <class T, template <class> class A>
+template <class... Args>
+typename List<T, A>::iterator List<T, A>::emplace(const_iterator pos,
+                                                  Args&&... args) {
+  ListEntry* newNode = createNode(std::forward<Args>(args)...);
+  linkBefore(pos.nodePtr_, newNode);
   return iterator(newNode, head_.nodePtr_);
 }
 
-template <class T>
-inline void List<T>::erase(typename List<T>::iterator pos) noexcept {
+template <class T, template <class> class A>
+inline void List<T, A>::erase(typename List<T, A>::iterator pos) noexcept {
   pos.nodePtr_->fLink->bLink = pos.nodePtr_->bLink;
   pos.nodePtr_->bLink->fLink = pos.nodePtr_->fLink;
-  delete pos.nodePtr_;
+  destroyNode(pos.nodePtr_);
   --size_;
 }
 
-template <class T>
-inline void List<T>::push_back(const T& val) noexcept {
-  iterator back = end();
-  auto newNode = new typename iterator::ListEntry();
-  newNode->fLink = back.nodePtr_;
-  newNode->bLink = back.nodePtr_->bLink;
-  newNode->entity = val;
-  back.nodePtr_->bLink->fLink = newNode;
-  back.nodePtr_->bLink = newNode;
-  ++size_;
+template <class T, template <class> class A>
+inline void List<T, A>::push_back(const T& val) {
+  emplace_back(val);
 }
 
-template <class T>
-inline void List<T>::pop_back() {
+template <class T, template <class> class A>
+inline void List<T, A>::push_back(T&& val) {
+  emplace_back(std::move(val));
+}
+
+template <class T, template <class> class A>
+template <class... Args>
+typename List<T, A>::reference List<T, A>::emplace_back(Args&&... args) {
+  ListEntry* newNode = createNode(std::forward<Args>(args)...);
+  linkBefore(head_.nodePtr_, newNode);
+  return newNode->entity;
+}
+
+template <class T, template <class> class A>
+inline void List<T, A>::pop_back() {
   if (empty()) throw(std::runtime_error("pop_back called on empty list"));
   erase(--end());
 }
 
-template <class T>
-inline void List<T>::push_front(const T& val) noexcept {
-  iterator back = end();
-  auto newNode = new typename iterator::ListEntry();
-  newNode->fLink = back.nodePtr_->fLink;
-  newNode->bLink = back.nodePtr_;
-  newNode->entity = val;
-  back.nodePtr_->fLink->bLink = newNode;
-  back.nodePtr_->fLink = newNode;
-  ++size_;
+template <class T, template <class> class A>
+inline void List<T, A>::push_front(const T& val) {
+  emplace_front(val);
 }
 
-template <class T>
-inline void List<T>::pop_front() {
+template <class T, template <class> class A>
+inline void List<T, A>::push_front(T&& val) {
+  emplace_front(std::move(val));
+}
+
+template <class T, template <class> class A>
+template <class... Args>
+typename List<T, A>::reference List<T, A>::emplace_front(Args&&... args) {
+  ListEntry* newNode = createNode(std::forward<Args>(args)...);
+  linkBefore(head_.nodePtr_->fLink, newNode);
+  return newNode->entity;
+}
+
+template <class T, template <class> class A>
+inline void List<T, A>::pop_front() {
   if (empty()) throw(std::runtime_error("pop_back called on empty list"));
   erase(begin());
 }
 
-template <class T>
-inline void List<T>::swap(List& other) noexcept {
+template <class T, template <class> class A>
+inline void List<T, A>::swap(List& other) noexcept {
   std::swap(size_, other.size_);
   std::swap(head_, other.head_);
+  allocator_.swap(other.allocator_);
 }
 
-template <class T>
-void List<T>::merge(List& other) noexcept {
+template <class T, template <class> class A>
+void List<T, A>::merge(List& other) noexcept {
   if (&other != this) {
     iterator thisIt = begin(), otherIt = other.begin();
     while (otherIt != other.end()) {
@@ -496,11 +598,12 @@ void List<T>::merge(List& other) noexcept {
     otherIt.nodePtr_->bLink = otherIt.nodePtr_;
     this->size_ = this->size_ + other.size_;
     other.size_ = 0;
+    allocator_.absorb(other.allocator_);
   }
 }
 
-template <class T>
-inline void List<T>::splice(const_iterator pos, List& other) noexcept {
+template <class T, template <class> class A>
+inline void List<T, A>::splice(const_iterator pos, List& other) noexcept {
   if (&other != this) {
     iterator it = other.begin();
     while (it != other.end()) {
@@ -514,11 +617,12 @@ inline void List<T>::splice(const_iterator pos, List& other) noexcept {
     it.nodePtr_->bLink = it.nodePtr_;
     this->size_ = this->size_ + other.size_;
     other.size_ = 0;
+    allocator_.absorb(other.allocator_);
   }
 }
 
-template <class T>
-inline void List<T>::reverse() noexcept {
+template <class T, template <class> class A>
+inline void List<T, A>::reverse() noexcept {
   iterator it = begin(), beg = begin();
   do {
     std::swap(it.nodePtr_->bLink, it.nodePtr_->fLink);
@@ -526,8 +630,8 @@ inline void List<T>::reverse() noexcept {
   } while (it != beg);
 }
 
-template <class T>
-void List<T>::unique() noexcept {
+template <class T, template <class> class A>
+void List<T, A>::unique() noexcept {
   for (iterator i = begin(); i != end(); ++i) {
     for (iterator j = i; j != end(); ++j) {
       if (i == j) continue;
@@ -539,33 +643,141 @@ void List<T>::unique() noexcept {
   }
 }
 
-template <class T>
-void List<T>::sort() noexcept {
-  for (iterator i = begin(); i != end();) {
-    iterator min = i;
-    for (iterator j = i; j != end(); ++j) {
-      if (*j < *min) min = j;
+template <class T, template <class> class A>
+void List<T, A>::sort() noexcept {
+  sort(std::less<T>());
+}
+
+// Stable bottom-up merge sort that only relinks nodes. runs[i] holds a
+// sorted run of 2^i nodes, merged like a binary counter; fLink is used as
+// a null-terminated chain and bLink is rebuilt once at the end.
+template <class T, template <class> class A>
+template <class Compare>
+void List<T, A>::sort(Compare comp) {
+  if (size_ < 2) return;
+  ListEntry* head = head_.nodePtr_;
+  head->bLink->fLink = nullptr;
+  ListEntry* runs[sizeof(size_type) * 8] = {};
+  size_type maxRun = 0;
+  ListEntry* node = head->fLink;
+  while (node) {
+    ListEntry* run = node;
+    node = node->fLink;
+    run->fLink = nullptr;
+    size_type i = 0;
+    for (; runs[i]; ++i) {
+      run = mergeRuns(runs[i], run, comp);
+      runs[i] = nullptr;
+    }
+    runs[i] = run;
+    if (i > maxRun) maxRun = i;
+  }
+  ListEntry* sorted = nullptr;
+  for (size_type i = 0; i <= maxRun; ++i) {
+    if (runs[i]) sorted = sorted ? mergeRuns(runs[i], sorted, comp) : runs[i];
+  }
+  ListEntry* prev = head;
+  head->fLink = sorted;
+  for (ListEntry* cur = sorted; cur; cur = cur->fLink) {
+    cur->bLink = prev;
+    prev = cur;
+  }
+  prev->fLink = head;
+  head->bLink = prev;
+}
+
+// Merges two null-terminated runs; on ties the left (earlier) node wins.
+template <class T, template <class> class A>
+template <class Compare>
+typename List<T, A>::ListEntry* List<T, A>::mergeRuns(ListEntry* left,
+                                                      ListEntry* right,
+                                                      Compare& comp) {
+  ListEntry* merged = nullptr;
+  ListEntry** tail = &merged;
+  while (left && right) {
+    if (comp(right->entity, left->entity)) {
+      *tail = right;
+      right = right->fLink;
+    } else {
+      *tail = left;
+      left = left->fLink;
     }
-    if (i != min) {
-      min.nodePtr_->fLink->bLink = min.nodePtr_->bLink;
-      min.nodePtr_->bLink->fLink = min.nodePtr_->fLink;
-      min.nodePtr_->fLink = i.nodePtr_;
-      min.nodePtr_->bLink = i.nodePtr_->bLink;
-      i.nodePtr_->bLink->fLink = min.nodePtr_;
-      i.nodePtr_->bLink = min.nodePtr_;
-    } else
-      ++i;
+    tail = &(*tail)->fLink;
   }
+  *tail = left ? left : right;
+  return merged;
 }
 
-template <class T>
-inline void List<T>::assign(const std::initializer_list<T>& el) noexcept {
+template <class T, template <class> class A>
+inline void List<T, A>::assign(const std::initializer_list<T>& el) {
   clear();
   for (const T& val : el) {
     push_back(val);
   }
 }
 
+// Every node goes in front of pos, so the arguments keep their order
+template <class T, template <class> class A>
+template <class... Args>
+typename List<T, A>::iterator List<T, A>::insert_many(const_iterator pos,
+                                                      Args&&... args) {
+  ListEntry* before = pos.nodePtr_->bLink;
+  (emplace(pos, std::forward<Args>(args)), ...);
+  return iterator(before->fLink, head_.nodePtr_);
+}
+
+template <class T, template <class> class A>
+template <class... Args>
+void List<T, A>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class T, template <class> class A>
+template <class... Args>
+void List<T, A>::insert_many_front(Args&&... args) {
+  insert_many(begin(), std::forward<Args>(args)...);
+}
+
+// The sentinel stays on the heap: a bulk-releasing allocator frees every
+// node it handed out on clear(), the sentinel included.
+template <class T, template <class> class A>
+inline void List<T, A>::createHead() {
+  head_.nodePtr_ = new ListEntry();
+  head_.nodePtr_->fLink = head_.nodePtr_;
+  head_.nodePtr_->bLink = head_.nodePtr_;
+  head_.headPtr_ = head_.nodePtr_;
+}
+
+// The element is built straight in the node from args
+template <class T, template <class> class A>
+template <class... Args>
+typename List<T, A>::ListEntry* List<T, A>::createNode(Args&&... args) {
+  ListEntry* node = allocator_.allocate();
+  try {
+    ::new (static_cast<void*>(node))
+        ListEntry{nullptr, nullptr, T(std::forward<Args>(args)...)};
+  } catch (...) {
+    allocator_.deallocate(node);
+    throw;
+  }
+  return node;
+}
+
+template <class T, template <class> class A>
+inline void List<T, A>::linkBefore(ListEntry* pos, ListEntry* node) noexcept {
+  node->fLink = pos;
+  node->bLink = pos->bLink;
+  pos->bLink->fLink = node;
+  pos->bLink = node;
+  ++size_;
+}
+
+template <class T, template <class> class A>
+inline void List<T, A>::destroyNode(ListEntry* node) noexcept {
+  node->~ListEntry();
+  allocator_.deallocate(node);
+}
+
 }  // namespace s21
 
 #endif  // !Containers_List_H
\ No newline at end of file
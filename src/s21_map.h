@@ -1,16 +1,28 @@
 #ifndef S21_MAP_H_
 #define S21_MAP_H_
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
-// #include <stdexcept>
 namespace s21 {
 
-template <typename Key, typename T>
+// Узлы выделяются через Allocator, приведенный к типу узла. Аллокатор
+// остается у контейнера при присваивании; swap, merge и вставка
+// извлеченного узла передают узлы без копирования, поэтому аллокаторы
+// обоих контейнеров должны быть равны (merge при неравных копирует)
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
 class Map {
  public:
   // Типы, определенные внутри класса
+  using allocator_type = Allocator;
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
@@ -23,19 +35,38 @@ class Map {
   using iterator = MapIterator;
   class MapConstIterator;
   using const_iterator = MapConstIterator;
+  // Узел, извлеченный из дерева (аналог node handle из C++17)
+  class MapNodeHandle;
+  using node_type = MapNodeHandle;
+  struct InsertReturn;
+  using insert_return_type = InsertReturn;
 
   // Конструкторы и деструктор+
   Map();
-  Map(std::initializer_list<value_type> const& items);
+  explicit Map(const allocator_type& alloc);
+  Map(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc = allocator_type());
   Map(const Map& m);
+  Map(const Map& m, const allocator_type& alloc);
   Map(Map&& m);
+  Map(Map&& m, const allocator_type& alloc);
   ~Map();
 
+  Map& operator=(const Map& m);
   Map& operator=(Map&& m);  //+
 
+  // Сбалансированное дерево за O(n) из диапазона со строго
+  // возрастающими ключами
+  template <typename ForwardIt>
+  static Map from_sorted(ForwardIt first, ForwardIt last,
+                         const allocator_type& alloc = allocator_type());
+
+  allocator_type get_allocator() const;
+
   // Доступ к элементам+
   T& at(const Key& key);
   T& operator[](const Key& key);
+  T& operator[](Key&& key);
 
   // Итераторы
   iterator begin();
@@ -51,42 +82,113 @@ class Map {
   // Модификаторы+
   void clear();
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
   std::pair<iterator, bool> insert(const Key& key, const T& obj);
   std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
   void erase(iterator pos);
   void swap(Map& other);
   void merge(Map& other);
+  node_type extract(iterator pos);
+  node_type extract(const Key& key);
+  insert_return_type insert(node_type&& node);
 
   // Поиск+
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
   bool contains(const Key& key) const;
+  iterator lower_bound(const Key& key);
+  const_iterator lower_bound(const Key& key) const;
+  iterator upper_bound(const Key& key);
+  const_iterator upper_bound(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key);
+  std::pair<const_iterator, const_iterator> equal_range(const Key& key) const;
 
  private:
+  // Set строит результаты операций над множествами через assign_sorted
+  template <typename, typename>
+  friend class Set;
+
   // Внутреннее представление бинарного дерева
+  // Узел красно-черного дерева; новый узел всегда красный.
+  // Пара конструируется прямо в узле из аргументов
   struct Node {
     value_type data;
     Node* left;
     Node* right;
     Node* parent;
-
-    Node(const value_type& value)
-        : data(value), left(nullptr), right(nullptr), parent(nullptr) {}
+    bool red;
+
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : data(std::forward<Args>(args)...),
+          left(nullptr),
+          right(nullptr),
+          parent(nullptr),
+          red(true) {}
   };
 
+  // Можно ли узнать ключ emplace(args...) без создания узла
+  template <typename... Args>
+  struct KeyFromArgs : std::false_type {};
+  template <typename First, typename Second>
+  struct KeyFromArgs<First, Second>
+      : std::is_same<std::decay_t<First>, Key> {};
+  template <typename Pair>
+  struct KeyFromArgs<Pair>
+      : std::is_same<std::decay_t<Pair>, value_type> {};
+
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  [[no_unique_address]] NodeAllocator node_alloc_;
   Node* root_;
   size_type size_;
 
   // Вспомогательные функции+
+  template <typename... Args>
+  Node* create_node(Args&&... args);
+  static void destroy_node(NodeAllocator& alloc, Node* node);
   void clear(Node* node);
+  Node* clone(const Node* node, Node* parent);
+  template <typename ForwardIt>
+  Node* build_balanced(ForwardIt& first, size_type count, size_type depth,
+                       size_type red_depth);
+  void steal(Map& m);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
   Node* find_node(const Key& key) const;
-  Node* insert_node(Node* node, const value_type& value);
-  Node* erase_node(Node* node, const Key& key);
+  Node* lower_bound_node(const Key& key) const;
+  Node* upper_bound_node(const Key& key) const;
+  Node* find_insert_position(const Key& key, Node*& parent,
+                             bool& left) const;
+  void link_node(Node* node, Node* parent, bool left);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace_key(const Key& key, Args&&... args);
+  void erase_node(Node* node);
+  void unlink_node(Node* node);
   Node* min_value_node(Node* node) const;
   void transplant(Node* u, Node* v);
+
+  // Балансировка красно-черного дерева
+  static bool is_red(const Node* node) { return node && node->red; }
+  void rotate_left(Node* node);
+  void rotate_right(Node* node);
+  void insert_fixup(Node* node);
+  void erase_fixup(Node* node, Node* parent);
 };
 
 // Реализация итераторов
-template <typename Key, typename T>
-class Map<Key, T>::MapIterator {
+template <typename Key, typename T, typename A>
+class Map<Key, T, A>::MapIterator {
  public:
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = typename Map::value_type;
@@ -112,11 +214,12 @@ class Map<Key, T>::MapIterator {
   }
 
  private:
+  friend class Map;
   Node* node_;
 };
 
-template <typename Key, typename T>
-class Map<Key, T>::MapConstIterator {
+template <typename Key, typename T, typename A>
+class Map<Key, T, A>::MapConstIterator {
  public:
   using iterator_category = std::bidirectional_iterator_tag;
   using value_type = typename Map::value_type;
@@ -142,74 +245,197 @@ class Map<Key, T>::MapConstIterator {
   }
 
  private:
+  friend class Map;
   Node* node_;
 };
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::begin() {
+// Владеет узлом вне дерева; пустой после вставки обратно
+template <typename Key, typename T, typename A>
+class Map<Key, T, A>::MapNodeHandle {
+ public:
+  using key_type = typename Map::key_type;
+  using mapped_type = typename Map::mapped_type;
+
+  using allocator_type = typename Map::allocator_type;
+
+  MapNodeHandle() : node_(nullptr) {}
+  MapNodeHandle(MapNodeHandle&& other) noexcept
+      : node_(other.node_), alloc_(std::move(other.alloc_)) {
+    other.node_ = nullptr;
+    other.alloc_.reset();
+  }
+  MapNodeHandle& operator=(MapNodeHandle&& other) noexcept {
+    if (this != &other) {
+      reset();
+      node_ = other.node_;
+      // У polymorphic_allocator нет присваивания, поэтому emplace
+      if (other.alloc_) alloc_.emplace(*other.alloc_);
+      other.node_ = nullptr;
+      other.alloc_.reset();
+    }
+    return *this;
+  }
+  MapNodeHandle(const MapNodeHandle&) = delete;
+  MapNodeHandle& operator=(const MapNodeHandle&) = delete;
+  ~MapNodeHandle() { reset(); }
+
+  bool empty() const { return node_ == nullptr; }
+  explicit operator bool() const { return node_ != nullptr; }
+  const key_type& key() const { return node_->data.first; }
+  mapped_type& mapped() const { return node_->data.second; }
+  allocator_type get_allocator() const { return allocator_type(*alloc_); }
+
+ private:
+  friend class Map;
+  MapNodeHandle(Node* node, const NodeAllocator& alloc)
+      : node_(node), alloc_(alloc) {}
+
+  void reset() {
+    if (node_) Map::destroy_node(*alloc_, node_);
+    node_ = nullptr;
+    alloc_.reset();
+  }
+
+  Node* node_;
+  std::optional<NodeAllocator> alloc_;  // Пуст вместе с узлом
+};
+
+template <typename Key, typename T, typename A>
+struct Map<Key, T, A>::InsertReturn {
+  iterator position;
+  bool inserted;
+  node_type node;
+};
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::iterator Map<Key, T, A>::begin() {
   return iterator(min_value_node(root_));
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::iterator Map<Key, T>::end() {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::iterator Map<Key, T, A>::end() {
   return iterator(nullptr);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::begin() const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::const_iterator Map<Key, T, A>::begin() const {
   return const_iterator(min_value_node(root_));
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::const_iterator Map<Key, T>::end() const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::const_iterator Map<Key, T, A>::end() const {
   return const_iterator(nullptr);
 }
 // Конструкторы и деструктор
 
-template <typename Key, typename T>
-Map<Key, T>::Map() : root_(nullptr), size_(0) {}
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map() : node_alloc_(), root_(nullptr), size_(0) {}
 
-template <typename Key, typename T>
-Map<Key, T>::Map(std::initializer_list<value_type> const& items) : Map() {
-  for (auto& item : items) {
-    insert(item);
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(const allocator_type& alloc)
+    : node_alloc_(alloc), root_(nullptr), size_(0) {}
+
+// Уже отсортированный список строится сразу сбалансированным деревом
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(std::initializer_list<value_type> const& items,
+                    const allocator_type& alloc)
+    : Map(alloc) {
+  auto not_ascending = [](const value_type& a, const value_type& b) {
+    return !(a.first < b.first);
+  };
+  if (std::adjacent_find(items.begin(), items.end(), not_ascending) ==
+      items.end()) {
+    assign_sorted(items.begin(), items.end());
+  } else {
+    for (auto& item : items) {
+      insert(item);
+    }
   }
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(const Map& m) : Map() {
-  for (auto it = m.begin(); it != m.end(); ++it) {
-    insert(*it);
-  }
+// Копия повторяет форму и цвета исходного дерева, без сравнений ключей
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(const Map& m)
+    : Map(m,
+          NodeTraits::select_on_container_copy_construction(m.node_alloc_)) {}
+
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(const Map& m, const allocator_type& alloc)
+    : node_alloc_(alloc), root_(nullptr), size_(0) {
+  root_ = clone(m.root_, nullptr);
+  size_ = m.size_;
 }
 
-template <typename Key, typename T>
-Map<Key, T>::Map(Map&& m) : root_(m.root_), size_(m.size_) {
-  m.root_ = nullptr;
-  m.size_ = 0;
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(Map&& m)
+    : node_alloc_(m.node_alloc_), root_(nullptr), size_(0) {
+  steal(m);
 }
 
-template <typename Key, typename T>
-Map<Key, T>::~Map() {
+// При разных аллокаторах элементы переносятся в новые узлы, дерево
+// строится сразу сбалансированным
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::Map(Map&& m, const allocator_type& alloc)
+    : node_alloc_(alloc), root_(nullptr), size_(0) {
+  if (node_alloc_ == m.node_alloc_) {
+    steal(m);
+  } else {
+    assign_sorted(std::make_move_iterator(m.begin()),
+                  std::make_move_iterator(m.end()));
+    m.clear();
+  }
+}
+
+template <typename Key, typename T, typename A>
+Map<Key, T, A>::~Map() {
   clear();
 }
 
-template <typename Key, typename T>
-Map<Key, T>& Map<Key, T>::operator=(Map&& m) {
+template <typename Key, typename T, typename A>
+Map<Key, T, A>& Map<Key, T, A>::operator=(const Map& m) {
   if (this != &m) {
+    Map copy(m, node_alloc_);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename A>
+Map<Key, T, A>& Map<Key, T, A>::operator=(Map&& m) {
+  if (this != &m && node_alloc_ == m.node_alloc_) {
     clear();
-    root_ = m.root_;
-    size_ = m.size_;
-    m.root_ = nullptr;
-    m.size_ = 0;
+    steal(m);
+  } else if (this != &m) {
+    Map moved(std::move(m), node_alloc_);
+    swap(moved);
   }
   return *this;
 }
 
+template <typename Key, typename T, typename A>
+template <typename ForwardIt>
+Map<Key, T, A> Map<Key, T, A>::from_sorted(ForwardIt first, ForwardIt last,
+                                           const allocator_type& alloc) {
+  auto not_ascending = [](const auto& a, const auto& b) {
+    return !(a.first < b.first);
+  };
+  if (std::adjacent_find(first, last, not_ascending) != last) {
+    throw std::invalid_argument("Keys are not strictly ascending");
+  }
+  Map result(alloc);
+  result.assign_sorted(first, last);
+  return result;
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::allocator_type Map<Key, T, A>::get_allocator() const {
+  return allocator_type(node_alloc_);
+}
+
 // Доступ к элементам
 
-template <typename Key, typename T>
-T& Map<Key, T>::at(const Key& key) {
+template <typename Key, typename T, typename A>
+T& Map<Key, T, A>::at(const Key& key) {
   Node* node = find_node(key);
   if (!node) {
     throw std::out_of_range("Key not found");
@@ -217,189 +443,504 @@ T& Map<Key, T>::at(const Key& key) {
   return node->data.second;
 }
 
-template <typename Key, typename T>
-T& Map<Key, T>::operator[](const Key& key) {
-  auto result = insert(std::make_pair(key, T()));
-  return result.first->second;
+// Значение T() создается только при отсутствии ключа
+template <typename Key, typename T, typename A>
+T& Map<Key, T, A>::operator[](const Key& key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename Key, typename T, typename A>
+T& Map<Key, T, A>::operator[](Key&& key) {
+  return try_emplace(std::move(key)).first->second;
 }
 
 // Вместимость
 
-template <typename Key, typename T>
-bool Map<Key, T>::empty() const {
+template <typename Key, typename T, typename A>
+bool Map<Key, T, A>::empty() const {
   return size_ == 0;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::size() const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::size_type Map<Key, T, A>::size() const {
   return size_;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::size_type Map<Key, T>::max_size() const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::size_type Map<Key, T, A>::max_size() const {
   return std::numeric_limits<size_type>::max() / sizeof(Node);
 }
 
 // Модификаторы
 
-template <typename Key, typename T>
-void Map<Key, T>::clear() {
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::clear() {
   clear(root_);
   root_ = nullptr;
   size_ = 0;
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::insert(
     const value_type& value) {
-  if (root_ == nullptr) {
-    root_ = new Node(value);
-    ++size_;
-    return std::make_pair(iterator(root_), true);
-  } else {
-    Node* node = insert_node(root_, value);
-    if (node) {
-      ++size_;
-      return std::make_pair(iterator(node), true);
-    } else {
-      return std::make_pair(iterator(find_node(value.first)), false);
-    }
-  }
+  return emplace_key(value.first, value);
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert(
-    const Key& key, const T& obj) {
-  return insert(std::make_pair(key, obj));
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::insert(
+    value_type&& value) {
+  return emplace_key(value.first, std::move(value));
 }
 
-template <typename Key, typename T>
-std::pair<typename Map<Key, T>::iterator, bool> Map<Key, T>::insert_or_assign(
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::insert(
     const Key& key, const T& obj) {
-  auto result = insert(std::make_pair(key, obj));
+  return emplace_key(key, key, obj);
+}
+
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::iterator, bool>
+Map<Key, T, A>::insert_or_assign(const Key& key, const T& obj) {
+  auto result = emplace_key(key, key, obj);
   if (!result.second) {
     result.first->second = obj;
   }
   return result;
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::erase(iterator pos) {
+template <typename Key, typename T, typename A>
+template <typename M>
+std::pair<typename Map<Key, T, A>::iterator, bool>
+Map<Key, T, A>::insert_or_assign(Key&& key, M&& obj) {
+  auto result = try_emplace(std::move(key), std::forward<M>(obj));
+  if (!result.second) {
+    result.first->second = std::forward<M>(obj);
+  }
+  return result;
+}
+
+// Если ключ виден среди аргументов, узел создается только при промахе;
+// иначе пара строится заранее, и узел удаляется, если ключ уже есть
+template <typename Key, typename T, typename A>
+template <typename... Args>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::emplace(
+    Args&&... args) {
+  if constexpr (KeyFromArgs<Args...>::value) {
+    const auto& key = std::get<0>(std::forward_as_tuple(args...));
+    if constexpr (sizeof...(Args) == 1) {
+      return emplace_key(key.first, std::forward<Args>(args)...);
+    } else {
+      return emplace_key(key, std::forward<Args>(args)...);
+    }
+  } else {
+    Node* node = create_node(std::forward<Args>(args)...);
+    Node* parent;
+    bool left;
+    Node* existing = find_insert_position(node->data.first, parent, left);
+    if (existing) {
+      destroy_node(node_alloc_, node);
+      return std::make_pair(iterator(existing), false);
+    }
+    link_node(node, parent, left);
+    return std::make_pair(iterator(node), true);
+  }
+}
+
+// Вставляет (key, T(args...)), если ключа нет; при наличии ключа
+// аргументы не используются
+template <typename Key, typename T, typename A>
+template <typename... Args>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::try_emplace(
+    const Key& key, Args&&... args) {
+  return emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename A>
+template <typename... Args>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::try_emplace(
+    Key&& key, Args&&... args) {
+  return emplace_key(key, std::piecewise_construct,
+                     std::forward_as_tuple(std::move(key)),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::erase(iterator pos) {
   if (pos == end()) return;
-  root_ = erase_node(root_, pos->first);
+  erase_node(pos.node_);
   --size_;
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::swap(Map& other) {
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::swap(Map& other) {
+  if constexpr (NodeTraits::propagate_on_container_swap::value) {
+    std::swap(node_alloc_, other.node_alloc_);
+  }
   std::swap(root_, other.root_);
   std::swap(size_, other.size_);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::merge(Map& other) {
-  for (auto it = other.begin(); it != other.end(); ++it) {
-    insert(*it);
+// Узлы other с новыми ключами перевешиваются в текущее дерево без
+// копирования; совпадающие по ключу остаются в other. Узлы из чужого
+// аллокатора не переносятся: значение перемещается в новый узел
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::merge(Map& other) {
+  if (this == &other) return;
+  const bool relink = node_alloc_ == other.node_alloc_;
+  for (auto it = other.begin(); it != other.end();) {
+    Node* node = (it++).node_;
+    Node* parent;
+    bool left;
+    if (!find_insert_position(node->data.first, parent, left)) {
+      if (relink) {
+        other.unlink_node(node);
+        link_node(node, parent, left);
+      } else {
+        link_node(create_node(std::move(node->data)), parent, left);
+        other.erase_node(node);
+      }
+      --other.size_;
+    }
   }
-  other.clear();
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::node_type Map<Key, T, A>::extract(iterator pos) {
+  if (pos == end()) return node_type();
+  unlink_node(pos.node_);
+  --size_;
+  return node_type(pos.node_, node_alloc_);
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::node_type Map<Key, T, A>::extract(const Key& key) {
+  return extract(find(key));
+}
+
+// При совпадении ключа узел возвращается обратно в node
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::insert_return_type Map<Key, T, A>::insert(
+    node_type&& node) {
+  if (node.empty()) return {end(), false, node_type()};
+  Node* parent;
+  bool left;
+  Node* existing = find_insert_position(node.key(), parent, left);
+  if (existing) return {iterator(existing), false, std::move(node)};
+  Node* raw = node.node_;
+  node.node_ = nullptr;
+  node.alloc_.reset();
+  link_node(raw, parent, left);
+  return {iterator(raw), true, node_type()};
 }
 
 // Поиск
 
-template <typename Key, typename T>
-bool Map<Key, T>::contains(const Key& key) const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::iterator Map<Key, T, A>::find(const Key& key) {
+  return iterator(find_node(key));
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::const_iterator Map<Key, T, A>::find(
+    const Key& key) const {
+  return const_iterator(find_node(key));
+}
+
+template <typename Key, typename T, typename A>
+bool Map<Key, T, A>::contains(const Key& key) const {
   return find_node(key) != nullptr;
 }
 
+// Первый элемент с ключом не меньше key
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::iterator Map<Key, T, A>::lower_bound(const Key& key) {
+  return iterator(lower_bound_node(key));
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::const_iterator Map<Key, T, A>::lower_bound(
+    const Key& key) const {
+  return const_iterator(lower_bound_node(key));
+}
+
+// Первый элемент с ключом больше key
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::iterator Map<Key, T, A>::upper_bound(const Key& key) {
+  return iterator(upper_bound_node(key));
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::const_iterator Map<Key, T, A>::upper_bound(
+    const Key& key) const {
+  return const_iterator(upper_bound_node(key));
+}
+
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::iterator, typename Map<Key, T, A>::iterator>
+Map<Key, T, A>::equal_range(const Key& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+template <typename Key, typename T, typename A>
+std::pair<typename Map<Key, T, A>::const_iterator,
+          typename Map<Key, T, A>::const_iterator>
+Map<Key, T, A>::equal_range(const Key& key) const {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
 // Вспомогательные функции
 
-template <typename Key, typename T>
-void Map<Key, T>::clear(Node* node) {
+template <typename Key, typename T, typename A>
+template <typename... Args>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::create_node(Args&&... args) {
+  Node* node = NodeTraits::allocate(node_alloc_, 1);
+  try {
+    ::new (static_cast<void*>(node)) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(node_alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::destroy_node(NodeAllocator& alloc, Node* node) {
+  node->~Node();
+  NodeTraits::deallocate(alloc, node, 1);
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::clear(Node* node) {
   if (node) {
     clear(node->left);
     clear(node->right);
-    delete node;
+    destroy_node(node_alloc_, node);
   }
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::Node* Map<Key, T>::find_node(const Key& key) const {
+// Забирает дерево m; аллокаторы должны быть равны
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::steal(Map& m) {
+  root_ = m.root_;
+  size_ = m.size_;
+  m.root_ = nullptr;
+  m.size_ = 0;
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::clone(const Node* node,
+                                                     Node* parent) {
+  if (!node) return nullptr;
+  Node* copy = create_node(node->data);
+  copy->red = node->red;
+  copy->parent = parent;
+  try {
+    copy->left = clone(node->left, copy);
+    copy->right = clone(node->right, copy);
+  } catch (...) {
+    clear(copy);
+    throw;
+  }
+  return copy;
+}
+
+// Строит дерево из count элементов, забирая их из first по порядку:
+// сначала левое поддерево, затем корень, затем правое. Размеры поддеревьев
+// отличаются не больше чем на один, поэтому все пустые ссылки лежат на двух
+// последних уровнях; узлы нижнего уровня red_depth красные, остальные
+// черные, и черная высота всех путей одинакова
+template <typename Key, typename T, typename A>
+template <typename ForwardIt>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::build_balanced(
+    ForwardIt& first, size_type count, size_type depth, size_type red_depth) {
+  if (count == 0) return nullptr;
+  const size_type left_count = count / 2;
+  Node* left = build_balanced(first, left_count, depth + 1, red_depth);
+  Node* node = nullptr;
+  try {
+    node = create_node(*first);
+    ++first;
+    node->left = left;
+    node->red = depth == red_depth;
+    node->right =
+        build_balanced(first, count - left_count - 1, depth + 1, red_depth);
+  } catch (...) {
+    if (node) {
+      clear(node);
+    } else {
+      clear(left);
+    }
+    throw;
+  }
+  if (node->left) node->left->parent = node;
+  if (node->right) node->right->parent = node;
+  return node;
+}
+
+template <typename Key, typename T, typename A>
+template <typename ForwardIt>
+void Map<Key, T, A>::assign_sorted(ForwardIt first, ForwardIt last) {
+  const size_type count = std::distance(first, last);
+  size_type red_depth = 0;  // Глубина нижнего уровня, floor(log2(count))
+  while ((size_type{2} << red_depth) <= count) ++red_depth;
+  clear();
+  root_ = build_balanced(first, count, 0, red_depth);
+  if (root_) root_->red = false;
+  size_ = count;
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::find_node(const Key& key) const {
   Node* current = root_;
   while (current) {
-    if (key == current->data.first) {
-      return current;
-    } else if (key < current->data.first) {
+    if (key < current->data.first) {
       current = current->left;
-    } else {
+    } else if (current->data.first < key) {
       current = current->right;
+    } else {
+      return current;
     }
   }
   return nullptr;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::Node* Map<Key, T>::insert_node(Node* node,
-                                                     const value_type& value) {
-  if (value.first == node->data.first) {
-    return nullptr;
-  } else if (value.first < node->data.first) {
-    if (node->left) {
-      return insert_node(node->left, value);
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::lower_bound_node(
+    const Key& key) const {
+  Node* result = nullptr;
+  Node* current = root_;
+  while (current) {
+    if (current->data.first < key) {
+      current = current->right;
     } else {
-      node->left = new Node(value);
-      node->left->parent = node;
-      return node->left;
+      result = current;
+      current = current->left;
     }
-  } else {
-    if (node->right) {
-      return insert_node(node->right, value);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::upper_bound_node(
+    const Key& key) const {
+  Node* result = nullptr;
+  Node* current = root_;
+  while (current) {
+    if (key < current->data.first) {
+      result = current;
+      current = current->left;
     } else {
-      node->right = new Node(value);
-      node->right->parent = node;
-      return node->right;
+      current = current->right;
     }
   }
+  return result;
 }
-template <typename Key, typename T>
-typename Map<Key, T>::Node* Map<Key, T>::erase_node(Node* node,
-                                                    const Key& key) {
-  if (node == nullptr) {
-    return node;  // Узел не найден
-  }
-  if (key < node->data.first) {
-    node->left = erase_node(node->left, key);
-  } else if (key > node->data.first) {
-    node->right = erase_node(node->right, key);
+
+// Спуск по дереву: возвращает узел с ключом key, либо nullptr и место
+// для нового узла (родитель и сторона)
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::find_insert_position(
+    const Key& key, Node*& parent, bool& left) const {
+  parent = nullptr;
+  left = false;
+  Node* current = root_;
+  while (current) {
+    parent = current;
+    if (key < current->data.first) {
+      left = true;
+      current = current->left;
+    } else if (current->data.first < key) {
+      left = false;
+      current = current->right;
+    } else {
+      return current;  // Ключ уже есть
+    }
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::link_node(Node* node, Node* parent, bool left) {
+  node->parent = parent;
+  if (!parent) {
+    root_ = node;
+  } else if (left) {
+    parent->left = node;
+  } else {
+    parent->right = node;
+  }
+  insert_fixup(node);
+  ++size_;
+}
+
+// Один спуск по дереву; узел из args создается только при промахе.
+// key может ссылаться на аргумент, который будет перемещен в узел,
+// поэтому после создания узла он не используется
+template <typename Key, typename T, typename A>
+template <typename... Args>
+std::pair<typename Map<Key, T, A>::iterator, bool> Map<Key, T, A>::emplace_key(
+    const Key& key, Args&&... args) {
+  Node* parent;
+  bool left;
+  Node* existing = find_insert_position(key, parent, left);
+  if (existing) {
+    return std::make_pair(iterator(existing), false);
+  }
+  Node* node = create_node(std::forward<Args>(args)...);
+  link_node(node, parent, left);
+  return std::make_pair(iterator(node), true);
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::erase_node(Node* node) {
+  unlink_node(node);
+  destroy_node(node_alloc_, node);
+}
+
+// Исключает узел из дерева, не удаляя его; поля связей узла сбрасываются,
+// чтобы его можно было снова вставить через link_node
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::unlink_node(Node* node) {
+  Node* moved = node;  // Узел, фактически покидающий свою позицию
+  bool moved_red = moved->red;
+  Node* child;
+  Node* child_parent;
+  if (!node->left) {
+    child = node->right;
+    child_parent = node->parent;
+    transplant(node, node->right);
+  } else if (!node->right) {
+    child = node->left;
+    child_parent = node->parent;
+    transplant(node, node->left);
   } else {
-    if (node->left == nullptr) {
-      Node* right_child = node->right;
-      transplant(node, right_child);
-      delete node;
-      return right_child;
-    } else if (node->right == nullptr) {
-      Node* left_child = node->left;
-      transplant(node, left_child);
-      delete node;
-      return left_child;
+    moved = min_value_node(node->right);
+    moved_red = moved->red;
+    child = moved->right;
+    if (moved->parent == node) {
+      child_parent = moved;
     } else {
-      Node* successor = min_value_node(node->right);
-      if (successor->parent != node) {
-        transplant(successor, successor->right);
-        successor->right = node->right;
-        successor->right->parent = successor;
-      }
-      transplant(node, successor);
-      successor->left = node->left;
-      successor->left->parent = successor;
-      delete node;
-      return successor;
+      child_parent = moved->parent;
+      transplant(moved, moved->right);
+      moved->right = node->right;
+      moved->right->parent = moved;
     }
+    transplant(node, moved);
+    moved->left = node->left;
+    moved->left->parent = moved;
+    moved->red = node->red;
   }
-  return node;
+  if (!moved_red) {
+    erase_fixup(child, child_parent);
+  }
+  node->left = node->right = node->parent = nullptr;
+  node->red = true;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::Node* Map<Key, T>::min_value_node(Node* node) const {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::Node* Map<Key, T, A>::min_value_node(
+    Node* node) const {
   Node* current = node;
   while (current && current->left) {
     current = current->left;
@@ -407,8 +948,8 @@ typename Map<Key, T>::Node* Map<Key, T>::min_value_node(Node* node) const {
   return current;
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::transplant(Node* u, Node* v) {
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::transplant(Node* u, Node* v) {
   if (!u->parent) {
     root_ = v;
   } else if (u == u->parent->left) {
@@ -421,10 +962,142 @@ void Map<Key, T>::transplant(Node* u, Node* v) {
   }
 }
 
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::rotate_left(Node* node) {
+  Node* pivot = node->right;
+  node->right = pivot->left;
+  if (pivot->left) {
+    pivot->left->parent = node;
+  }
+  transplant(node, pivot);
+  pivot->left = node;
+  node->parent = pivot;
+}
+
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::rotate_right(Node* node) {
+  Node* pivot = node->left;
+  node->left = pivot->right;
+  if (pivot->right) {
+    pivot->right->parent = node;
+  }
+  transplant(node, pivot);
+  pivot->right = node;
+  node->parent = pivot;
+}
+
+// Восстановление свойств дерева после вставки красного узла
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::insert_fixup(Node* node) {
+  while (is_red(node->parent)) {
+    Node* parent = node->parent;
+    Node* grandparent = parent->parent;
+    if (parent == grandparent->left) {
+      Node* uncle = grandparent->right;
+      if (is_red(uncle)) {
+        parent->red = false;
+        uncle->red = false;
+        grandparent->red = true;
+        node = grandparent;
+      } else {
+        if (node == parent->right) {
+          node = parent;
+          rotate_left(node);
+          parent = node->parent;
+        }
+        parent->red = false;
+        grandparent->red = true;
+        rotate_right(grandparent);
+      }
+    } else {
+      Node* uncle = grandparent->left;
+      if (is_red(uncle)) {
+        parent->red = false;
+        uncle->red = false;
+        grandparent->red = true;
+        node = grandparent;
+      } else {
+        if (node == parent->left) {
+          node = parent;
+          rotate_right(node);
+          parent = node->parent;
+        }
+        parent->red = false;
+        grandparent->red = true;
+        rotate_left(grandparent);
+      }
+    }
+  }
+  root_->red = false;
+}
+
+// Восстановление свойств дерева после удаления черного узла;
+// node может быть nullptr, поэтому родитель передается отдельно
+template <typename Key, typename T, typename A>
+void Map<Key, T, A>::erase_fixup(Node* node, Node* parent) {
+  while (node != root_ && !is_red(node)) {
+    if (node == parent->left) {
+      Node* sibling = parent->right;
+      if (is_red(sibling)) {
+        sibling->red = false;
+        parent->red = true;
+        rotate_left(parent);
+        sibling = parent->right;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!is_red(sibling->right)) {
+          sibling->left->red = false;
+          sibling->red = true;
+          rotate_right(sibling);
+          sibling = parent->right;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        sibling->right->red = false;
+        rotate_left(parent);
+        node = root_;
+      }
+    } else {
+      Node* sibling = parent->left;
+      if (is_red(sibling)) {
+        sibling->red = false;
+        parent->red = true;
+        rotate_right(parent);
+        sibling = parent->left;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!is_red(sibling->left)) {
+          sibling->right->red = false;
+          sibling->red = true;
+          rotate_left(sibling);
+          sibling = parent->left;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        sibling->left->red = false;
+        rotate_right(parent);
+        node = root_;
+      }
+    }
+  }
+  if (node) {
+    node->red = false;
+  }
+}
+
 // Реализация итераторов
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapIterator& Map<Key, T>::MapIterator::operator++() {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapIterator&
+Map<Key, T, A>::MapIterator::operator++() {
   if (node_->right) {
     node_ = node_->right;
     while (node_->left) {
@@ -441,15 +1114,17 @@ typename Map<Key, T>::MapIterator& Map<Key, T>::MapIterator::operator++() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapIterator Map<Key, T>::MapIterator::operator++(int) {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapIterator
+Map<Key, T, A>::MapIterator::operator++(int) {
   MapIterator tmp = *this;
   ++(*this);
   return tmp;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapIterator& Map<Key, T>::MapIterator::operator--() {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapIterator&
+Map<Key, T, A>::MapIterator::operator--() {
   if (node_->left) {
     node_ = node_->left;
     while (node_->right) {
@@ -466,16 +1141,17 @@ typename Map<Key, T>::MapIterator& Map<Key, T>::MapIterator::operator--() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapIterator Map<Key, T>::MapIterator::operator--(int) {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapIterator
+Map<Key, T, A>::MapIterator::operator--(int) {
   MapIterator tmp = *this;
   --(*this);
   return tmp;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapConstIterator&
-Map<Key, T>::MapConstIterator::operator++() {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapConstIterator&
+Map<Key, T, A>::MapConstIterator::operator++() {
   if (node_->right) {
     node_ = node_->right;
     while (node_->left) {
@@ -492,17 +1168,17 @@ Map<Key, T>::MapConstIterator::operator++() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapConstIterator
-Map<Key, T>::MapConstIterator::operator++(int) {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapConstIterator
+Map<Key, T, A>::MapConstIterator::operator++(int) {
   MapConstIterator tmp = *this;
   ++(*this);
   return tmp;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapConstIterator&
-Map<Key, T>::MapConstIterator::operator--() {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapConstIterator&
+Map<Key, T, A>::MapConstIterator::operator--() {
   if (node_->left) {
     node_ = node_->left;
     while (node_->right) {
@@ -519,14 +1195,20 @@ Map<Key, T>::MapConstIterator::operator--() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::MapConstIterator
-Map<Key, T>::MapConstIterator::operator--(int) {
+template <typename Key, typename T, typename A>
+typename Map<Key, T, A>::MapConstIterator
+Map<Key, T, A>::MapConstIterator::operator--(int) {
   MapConstIterator tmp = *this;
   --(*this);
   return tmp;
 }
 
+namespace pmr {
+template <typename Key, typename T>
+using Map = s21::Map<Key, T,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // S21_MAP_H_
@@ -0,0 +1,446 @@
+#ifndef S21_MAPPED_VECTOR_H
+#define S21_MAPPED_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+
+namespace s21 {
+
+// How the elements of a MappedVector are about to be read; passed to the
+// kernel with madvise so that it reads ahead or stops doing so.
+enum class AccessPattern {
+  kNormal,      // default read-ahead
+  kSequential,  // aggressive read-ahead, pages dropped soon after use
+  kRandom,      // no read-ahead
+  kWillNeed,    // start reading the whole file in now
+};
+
+namespace mapped_detail {
+
+[[noreturn]] inline void ThrowErrno(const char* what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+inline std::size_t PageSize() {
+  static const std::size_t page_size =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+
+inline int Advice(AccessPattern pattern) {
+  switch (pattern) {
+    case AccessPattern::kSequential:
+      return MADV_SEQUENTIAL;
+    case AccessPattern::kRandom:
+      return MADV_RANDOM;
+    case AccessPattern::kWillNeed:
+      return MADV_WILLNEED;
+    default:
+      return MADV_NORMAL;
+  }
+}
+
+}  // namespace mapped_detail
+
+// Vector whose elements live in a file mapped into memory: opening even a
+// huge file costs one mmap, and pages are read in only when touched, so
+// arrays larger than RAM work with the usual algorithms over T*.
+//
+// The file holds the raw elements and nothing else, so only trivially
+// copyable T can be stored. While the vector is open the file is as long
+// as the capacity; growth extends it with ftruncate and remaps it (mremap
+// on Linux, a fresh mmap elsewhere), which never copies the elements. On
+// destruction the file is cut back to size() elements. Writes reach the
+// page cache at once but the disk only when the kernel flushes them or
+// after sync()/flush_range().
+template <typename T, typename Growth = GrowDouble>
+class MappedVector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MappedVector stores raw bytes: T must be trivially copyable");
+
+ public:
+  // Member types
+  using growth_policy = Growth;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+  // Constructors
+  // Opens path for reading and writing, creating an empty file if there
+  // is none. An existing file must hold a whole number of elements.
+  explicit MappedVector(const std::string& path);
+  MappedVector(const MappedVector&) = delete;
+  MappedVector(MappedVector&& v) noexcept;
+  ~MappedVector();
+
+  // Operator=
+  MappedVector& operator=(const MappedVector&) = delete;
+  MappedVector& operator=(MappedVector&& v) noexcept;
+
+  // Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+  const_reference front() const { return data_[0]; }
+  const_reference back() const { return data_[size_ - 1]; }
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+  // Iterators
+  iterator begin() { return data_; }
+  const_iterator begin() const { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator end() const { return data_ + size_; }
+
+  // Capacity
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const { return capacity_; }
+  void shrink_to_fit();
+
+  // Modifiers
+  void clear() { size_ = 0; }
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void push_back(const_reference value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  void pop_back();
+  void resize(size_type count);
+  void swap(MappedVector& other) noexcept;
+
+  // File
+  // Hint for the whole mapping; kept across growth
+  void advise(AccessPattern pattern);
+  // Writes every dirty page to disk and waits for it
+  void sync();
+  // Writes the pages holding elements [first, first + count) to disk
+  void flush_range(size_type first, size_type count);
+
+ private:
+  int fd_;
+  T* data_;
+  size_type size_;
+  size_type capacity_;
+  AccessPattern pattern_;
+
+  void remap(size_type new_capacity);
+  void map(size_type new_capacity);
+  void truncate(size_type new_capacity);
+  void close() noexcept;
+  size_type grown_capacity() const;
+};
+
+// Implementations
+
+// Constructors
+template <typename T, typename G>
+MappedVector<T, G>::MappedVector(const std::string& path)
+    : fd_(-1),
+      data_(nullptr),
+      size_(0),
+      capacity_(0),
+      pattern_(AccessPattern::kNormal) {
+  fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd_ < 0) mapped_detail::ThrowErrno("MappedVector: open");
+  struct stat info;
+  if (::fstat(fd_, &info) != 0) {
+    const int error = errno;
+    ::close(fd_);
+    throw std::system_error(error, std::generic_category(),
+                            "MappedVector: fstat");
+  }
+  const auto bytes = static_cast<size_type>(info.st_size);
+  if (bytes % sizeof(T) != 0) {
+    ::close(fd_);
+    throw std::runtime_error(
+        "MappedVector: file size is not a multiple of the element size");
+  }
+  try {
+    map(bytes / sizeof(T));
+  } catch (...) {
+    ::close(fd_);
+    throw;
+  }
+  size_ = capacity_;
+}
+
+template <typename T, typename G>
+MappedVector<T, G>::MappedVector(MappedVector&& v) noexcept
+    : fd_(std::exchange(v.fd_, -1)),
+      data_(std::exchange(v.data_, nullptr)),
+      size_(std::exchange(v.size_, 0)),
+      capacity_(std::exchange(v.capacity_, 0)),
+      pattern_(v.pattern_) {}
+
+template <typename T, typename G>
+MappedVector<T, G>::~MappedVector() {
+  close();
+}
+
+// Operator=
+template <typename T, typename G>
+MappedVector<T, G>& MappedVector<T, G>::operator=(MappedVector&& v) noexcept {
+  if (this != &v) {
+    close();
+    fd_ = std::exchange(v.fd_, -1);
+    data_ = std::exchange(v.data_, nullptr);
+    size_ = std::exchange(v.size_, 0);
+    capacity_ = std::exchange(v.capacity_, 0);
+    pattern_ = v.pattern_;
+  }
+  return *this;
+}
+
+// Element access
+template <typename T, typename G>
+typename MappedVector<T, G>::reference MappedVector<T, G>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("MappedVector::at: index out of range");
+  }
+  return data_[pos];
+}
+
+// Capacity
+template <typename T, typename G>
+typename MappedVector<T, G>::size_type MappedVector<T, G>::max_size() const {
+  return static_cast<size_type>(std::numeric_limits<off_t>::max()) /
+         sizeof(T);
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::reserve(size_type new_capacity) {
+  if (new_capacity > capacity_) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("MappedVector::reserve: capacity too large");
+    }
+    remap(new_capacity);
+  }
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::shrink_to_fit() {
+  if (size_ < capacity_) {
+    remap(size_);
+  }
+}
+
+// Modifiers
+template <typename T, typename G>
+typename MappedVector<T, G>::iterator MappedVector<T, G>::insert(
+    iterator pos, const_reference value) {
+  const size_type index = pos - begin();
+  // Copied first: value may be an element, and remapping may move them
+  const T copy(value);
+  if (size_ == capacity_) {
+    remap(grown_capacity());
+  }
+  std::memmove(static_cast<void*>(data_ + index + 1), data_ + index,
+               (size_ - index) * sizeof(T));
+  data_[index] = copy;
+  ++size_;
+  return begin() + index;
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::erase(iterator pos) {
+  if (pos >= begin() && pos < end()) {
+    std::memmove(static_cast<void*>(pos), pos + 1,
+                 (end() - pos - 1) * sizeof(T));
+    --size_;
+  }
+}
+
+template <typename T, typename G>
+typename MappedVector<T, G>::iterator MappedVector<T, G>::erase(
+    iterator first, iterator last) {
+  if (first != last) {
+    std::memmove(static_cast<void*>(first), last,
+                 (end() - last) * sizeof(T));
+    size_ -= last - first;
+  }
+  return first;
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename G>
+template <typename... Args>
+typename MappedVector<T, G>::reference MappedVector<T, G>::emplace_back(
+    Args&&... args) {
+  if (size_ == capacity_) {
+    const T value(std::forward<Args>(args)...);
+    remap(grown_capacity());
+    ::new (static_cast<void*>(data_ + size_)) T(value);
+  } else {
+    ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+  }
+  return data_[size_++];
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::pop_back() {
+  if (size_ > 0) {
+    --size_;
+  }
+}
+
+// New elements are value-initialized, as in a freshly extended file
+template <typename T, typename G>
+void MappedVector<T, G>::resize(size_type count) {
+  reserve(count);
+  for (size_type i = size_; i < count; ++i) {
+    ::new (static_cast<void*>(data_ + i)) T();
+  }
+  size_ = count;
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::swap(MappedVector& other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(pattern_, other.pattern_);
+}
+
+// File
+template <typename T, typename G>
+void MappedVector<T, G>::advise(AccessPattern pattern) {
+  pattern_ = pattern;
+  if (capacity_ > 0 &&
+      ::madvise(static_cast<void*>(data_), capacity_ * sizeof(T),
+                mapped_detail::Advice(pattern)) != 0) {
+    mapped_detail::ThrowErrno("MappedVector: madvise");
+  }
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::sync() {
+  if (capacity_ > 0 && ::msync(static_cast<void*>(data_),
+                               capacity_ * sizeof(T), MS_SYNC) != 0) {
+    mapped_detail::ThrowErrno("MappedVector: msync");
+  }
+}
+
+// msync wants a page-aligned start, so the range is widened down to the
+// page holding the first element
+template <typename T, typename G>
+void MappedVector<T, G>::flush_range(size_type first, size_type count) {
+  if (first > size_ || count > size_ - first) {
+    throw std::out_of_range("MappedVector::flush_range: range out of bounds");
+  }
+  if (count == 0) return;
+  const size_type begin_byte = first * sizeof(T);
+  const size_type end_byte = (first + count) * sizeof(T);
+  const size_type page_start =
+      begin_byte - begin_byte % mapped_detail::PageSize();
+  char* base = reinterpret_cast<char*>(data_);
+  if (::msync(base + page_start, end_byte - page_start, MS_SYNC) != 0) {
+    mapped_detail::ThrowErrno("MappedVector: msync");
+  }
+}
+
+// Private helpers
+
+// The file grows before the mapping does and shrinks after it, so no
+// mapped page is ever past the end of the file
+template <typename T, typename G>
+void MappedVector<T, G>::remap(size_type new_capacity) {
+  const size_type old_capacity = capacity_;
+  if (new_capacity > old_capacity) truncate(new_capacity);
+  if (old_capacity == 0) {
+    map(new_capacity);
+  } else if (new_capacity == 0) {
+    ::munmap(static_cast<void*>(data_), old_capacity * sizeof(T));
+    data_ = nullptr;
+    capacity_ = 0;
+  } else {
+#ifdef MREMAP_MAYMOVE
+    // Moves the page table entries, not the data; the advice stays
+    void* addr = ::mremap(static_cast<void*>(data_), old_capacity * sizeof(T),
+                          new_capacity * sizeof(T), MREMAP_MAYMOVE);
+    if (addr == MAP_FAILED) mapped_detail::ThrowErrno("MappedVector: mremap");
+    data_ = static_cast<T*>(addr);
+    capacity_ = new_capacity;
+#else
+    // The mapping is shared, so the elements wait in the file
+    ::munmap(static_cast<void*>(data_), old_capacity * sizeof(T));
+    data_ = nullptr;
+    capacity_ = 0;
+    map(new_capacity);
+#endif
+  }
+  if (new_capacity < old_capacity) truncate(new_capacity);
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::map(size_type new_capacity) {
+  if (new_capacity > 0) {
+    void* addr = ::mmap(nullptr, new_capacity * sizeof(T),
+                        PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) mapped_detail::ThrowErrno("MappedVector: mmap");
+    data_ = static_cast<T*>(addr);
+    capacity_ = new_capacity;
+    if (pattern_ != AccessPattern::kNormal) advise(pattern_);
+  }
+}
+
+template <typename T, typename G>
+void MappedVector<T, G>::truncate(size_type new_capacity) {
+  if (::ftruncate(fd_, static_cast<off_t>(new_capacity * sizeof(T))) != 0) {
+    mapped_detail::ThrowErrno("MappedVector: ftruncate");
+  }
+}
+
+// Unmapping keeps the written pages in the page cache; the file is cut to
+// the elements in use so that it reopens with the same size
+template <typename T, typename G>
+void MappedVector<T, G>::close() noexcept {
+  if (fd_ < 0) return;
+  if (capacity_ > 0) {
+    ::munmap(static_cast<void*>(data_), capacity_ * sizeof(T));
+  }
+  if (::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T))) != 0) {
+    // Nothing to report from a destructor; the file keeps the capacity
+  }
+  ::close(fd_);
+  fd_ = -1;
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+template <typename T, typename G>
+typename MappedVector<T, G>::size_type MappedVector<T, G>::grown_capacity()
+    const {
+  return G::next_capacity(capacity_, sizeof(T));
+}
+
+}  // namespace s21
+
+#endif  // S21_MAPPED_VECTOR_H
@@ -0,0 +1,300 @@
+#ifndef S21_MEMORY_RESOURCE_H
+#define S21_MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "s21_node_allocator.h"
+
+namespace s21 {
+
+// Monotonic arena. Allocations are carved from blocks obtained from the
+// upstream resource with a bump pointer, deallocate() is a no-op, and the
+// whole arena is reclaimed at once by reset() or release(). Blocks grow
+// geometrically up to kMaxBlockBytes. Not thread-safe.
+//
+// reset() keeps the newest (largest) block and rewinds into it, so an arena
+// reused per request stops touching the upstream once it has seen its
+// working size; release() hands every block back.
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t kDefaultBlockBytes = 4096;
+  static constexpr std::size_t kMaxBlockBytes = std::size_t{1} << 20;
+
+  explicit ArenaResource(
+      std::size_t initial_block_bytes = kDefaultBlockBytes,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : upstream_(upstream),
+        next_block_bytes_(initial_block_bytes > kHeaderSize
+                              ? initial_block_bytes
+                              : kDefaultBlockBytes) {}
+
+  // Serves allocations from buffer first; the buffer is never freed.
+  ArenaResource(
+      void* buffer, std::size_t size,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : upstream_(upstream),
+        buffer_(static_cast<char*>(buffer)),
+        buffer_size_(size),
+        current_(buffer_),
+        end_(buffer_ + size),
+        next_block_bytes_(size > kDefaultBlockBytes ? size
+                                                    : kDefaultBlockBytes) {}
+
+  ArenaResource(const ArenaResource&) = delete;
+  ArenaResource& operator=(const ArenaResource&) = delete;
+  ~ArenaResource() override { release(); }
+
+  // Forgets every allocation and keeps the newest block for reuse.
+  void reset() noexcept {
+    if (blocks_) {
+      Block* keep = blocks_;
+      blocks_ = keep->next;
+      release_blocks();
+      keep->next = nullptr;
+      blocks_ = keep;
+      current_ = reinterpret_cast<char*>(keep) + kHeaderSize;
+      end_ = reinterpret_cast<char*>(keep) + keep->size;
+    } else {
+      current_ = buffer_;
+      end_ = buffer_ + buffer_size_;
+    }
+    bytes_in_use_ = 0;
+  }
+
+  // Returns every block to the upstream resource.
+  void release() noexcept {
+    release_blocks();
+    current_ = buffer_;
+    end_ = buffer_ + buffer_size_;
+    bytes_in_use_ = 0;
+  }
+
+  std::pmr::memory_resource* upstream_resource() const noexcept {
+    return upstream_;
+  }
+  // Bytes handed out since the last reset()/release()
+  std::size_t bytes_in_use() const noexcept { return bytes_in_use_; }
+  // node_* count allocate/deallocate calls, system_* count upstream blocks
+  const AllocationStats& stats() const noexcept { return stats_; }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    char* result = align_up(current_, alignment);
+    if (!result || result > end_ ||
+        bytes > static_cast<std::size_t>(end_ - result)) {
+      add_block(bytes, alignment);
+      result = align_up(current_, alignment);
+    }
+    current_ = result + bytes;
+    bytes_in_use_ += bytes;
+    ++stats_.node_allocations;
+    return result;
+  }
+
+  void do_deallocate(void*, std::size_t, std::size_t) noexcept override {
+    ++stats_.node_deallocations;
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct Block {
+    Block* next;
+    std::size_t size;  // Including the header
+  };
+
+  static constexpr std::size_t kHeaderSize =
+      (sizeof(Block) + alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+
+  static char* align_up(char* ptr, std::size_t alignment) noexcept {
+    if (!ptr) return nullptr;
+    std::uintptr_t value = reinterpret_cast<std::uintptr_t>(ptr);
+    std::uintptr_t aligned = (value + alignment - 1) & ~(alignment - 1);
+    return ptr + (aligned - value);
+  }
+
+  void add_block(std::size_t bytes, std::size_t alignment) {
+    std::size_t size = next_block_bytes_;
+    std::size_t needed = kHeaderSize + bytes + alignment;
+    while (size < needed) size *= 2;
+    void* memory = upstream_->allocate(size, alignof(std::max_align_t));
+    ++stats_.system_allocations;
+    blocks_ = ::new (memory) Block{blocks_, size};
+    current_ = static_cast<char*>(memory) + kHeaderSize;
+    end_ = static_cast<char*>(memory) + size;
+    if (next_block_bytes_ < kMaxBlockBytes) next_block_bytes_ *= 2;
+  }
+
+  void release_blocks() noexcept {
+    while (blocks_) {
+      Block* next = blocks_->next;
+      upstream_->deallocate(blocks_, blocks_->size,
+                            alignof(std::max_align_t));
+      ++stats_.system_deallocations;
+      blocks_ = next;
+    }
+  }
+
+  std::pmr::memory_resource* upstream_;
+  char* buffer_ = nullptr;
+  std::size_t buffer_size_ = 0;
+  Block* blocks_ = nullptr;  // Newest first, it serves the bump pointer
+  char* current_ = nullptr;
+  char* end_ = nullptr;
+  std::size_t next_block_bytes_;
+  std::size_t bytes_in_use_ = 0;
+  AllocationStats stats_;
+};
+
+// Pool resource with power-of-two size classes from kMinBlock to
+// kMaxBlock bytes. Each class carves its blocks out of chunks that double
+// in size (as PoolNodeAllocator slabs do) and recycles freed blocks through
+// an intrusive freelist, so node-based containers that churn reuse memory
+// without reaching the upstream. release() returns all chunks at once.
+// Larger or over-aligned requests go straight to the upstream resource and
+// must be deallocated individually. Not thread-safe.
+class PoolResource : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t kMinBlock = 8;
+  static constexpr std::size_t kMaxBlock = 512;
+  static constexpr std::size_t kMinChunkBlocks = 16;
+  static constexpr std::size_t kMaxChunkBytes = std::size_t{1} << 18;
+
+  explicit PoolResource(
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : upstream_(upstream) {
+    for (Pool& pool : pools_) pool.next_chunk_blocks = kMinChunkBlocks;
+  }
+
+  PoolResource(const PoolResource&) = delete;
+  PoolResource& operator=(const PoolResource&) = delete;
+  ~PoolResource() override { release(); }
+
+  // Returns every pooled chunk to the upstream resource. Blocks of all
+  // classes become invalid; oversized blocks are not affected.
+  void release() noexcept {
+    for (Pool& pool : pools_) {
+      while (pool.chunks) {
+        Chunk* next = pool.chunks->next;
+        upstream_->deallocate(pool.chunks, pool.chunks->size, kChunkAlign);
+        ++stats_.system_deallocations;
+        pool.chunks = next;
+      }
+      pool.free_list = nullptr;
+      pool.next_chunk_blocks = kMinChunkBlocks;
+    }
+  }
+
+  std::pmr::memory_resource* upstream_resource() const noexcept {
+    return upstream_;
+  }
+  // node_* count allocate/deallocate calls, system_* count upstream calls
+  const AllocationStats& stats() const noexcept { return stats_; }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++stats_.node_allocations;
+    if (!pooled(bytes, alignment)) {
+      ++stats_.system_allocations;
+      return upstream_->allocate(bytes, alignment);
+    }
+    const std::size_t index = size_class(bytes, alignment);
+    Pool& pool = pools_[index];
+    if (pool.free_list) {
+      FreeBlock* block = pool.free_list;
+      pool.free_list = block->next;
+      return block;
+    }
+    const std::size_t block_size = kMinBlock << index;
+    if (!pool.chunks || pool.chunks->used == pool.chunks->capacity) {
+      add_chunk(pool, block_size);
+    }
+    return reinterpret_cast<char*>(pool.chunks) + kHeaderSize +
+           pool.chunks->used++ * block_size;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes,
+                     std::size_t alignment) noexcept override {
+    ++stats_.node_deallocations;
+    if (!pooled(bytes, alignment)) {
+      upstream_->deallocate(ptr, bytes, alignment);
+      ++stats_.system_deallocations;
+      return;
+    }
+    Pool& pool = pools_[size_class(bytes, alignment)];
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->next = pool.free_list;
+    pool.free_list = block;
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct Chunk {
+    Chunk* next;
+    std::size_t size;  // Bytes, including the header
+    std::size_t capacity;
+    std::size_t used;
+  };
+
+  struct Pool {
+    Chunk* chunks = nullptr;  // Newest first, it serves bump allocation
+    FreeBlock* free_list = nullptr;
+    std::size_t next_chunk_blocks = 0;
+  };
+
+  static constexpr std::size_t kChunkAlign = alignof(std::max_align_t);
+  static constexpr std::size_t kHeaderSize =
+      (sizeof(Chunk) + kChunkAlign - 1) / kChunkAlign * kChunkAlign;
+  static constexpr std::size_t kClasses = 7;  // 8, 16, ..., 512
+  static_assert(kMinBlock << (kClasses - 1) == kMaxBlock,
+                "size classes must cover kMinBlock..kMaxBlock");
+
+  // Blocks sit at multiples of their power-of-two size from a
+  // max_align_t-aligned base, so alignments up to that size are honored.
+  static bool pooled(std::size_t bytes, std::size_t alignment) noexcept {
+    return bytes <= kMaxBlock && alignment <= kChunkAlign;
+  }
+
+  static std::size_t size_class(std::size_t bytes,
+                                std::size_t alignment) noexcept {
+    std::size_t size = bytes > alignment ? bytes : alignment;
+    std::size_t index = 0;
+    while ((kMinBlock << index) < size) ++index;
+    return index;
+  }
+
+  void add_chunk(Pool& pool, std::size_t block_size) {
+    const std::size_t size = kHeaderSize + pool.next_chunk_blocks * block_size;
+    void* memory = upstream_->allocate(size, kChunkAlign);
+    ++stats_.system_allocations;
+    pool.chunks =
+        ::new (memory) Chunk{pool.chunks, size, pool.next_chunk_blocks, 0};
+    if (2 * pool.next_chunk_blocks * block_size <= kMaxChunkBytes) {
+      pool.next_chunk_blocks *= 2;
+    }
+  }
+
+  std::pmr::memory_resource* upstream_;
+  Pool pools_[kClasses];
+  AllocationStats stats_;
+};
+
+}  // namespace s21
+
+#endif  // S21_MEMORY_RESOURCE_H
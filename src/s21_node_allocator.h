@@ -0,0 +1,227 @@
+#ifndef S21_NODE_ALLOCATOR_H
+#define S21_NODE_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Counters shared by every node allocator. node_* count nodes handed out
+// and returned, system_* count calls that reached the global operator new.
+struct AllocationStats {
+  std::size_t node_allocations = 0;
+  std::size_t node_deallocations = 0;
+  std::size_t system_allocations = 0;
+  std::size_t system_deallocations = 0;
+};
+
+// Default node allocator: one operator new/delete per node.
+template <class Node>
+class NewNodeAllocator {
+ public:
+  // Nodes must be returned one by one with deallocate().
+  static constexpr bool kBulkRelease = false;
+
+  NewNodeAllocator() = default;
+  NewNodeAllocator(const NewNodeAllocator&) = delete;
+  NewNodeAllocator& operator=(const NewNodeAllocator&) = delete;
+
+  Node* allocate() {
+    Node* node = static_cast<Node*>(::operator new(sizeof(Node)));
+    ++stats_.node_allocations;
+    ++stats_.system_allocations;
+    return node;
+  }
+
+  void deallocate(Node* node) noexcept {
+    ::operator delete(node);
+    ++stats_.node_deallocations;
+    ++stats_.system_deallocations;
+  }
+
+  void release() noexcept {}
+  void absorb(NewNodeAllocator&) noexcept {}
+  void swap(NewNodeAllocator& other) noexcept {
+    std::swap(stats_, other.stats_);
+  }
+
+  const AllocationStats& stats() const noexcept { return stats_; }
+
+ private:
+  AllocationStats stats_;
+};
+
+// Slab allocator for fixed-size nodes. Nodes are carved out of
+// cache-line-aligned slabs that double in size up to kMaxSlabNodes, freed
+// nodes are recycled through an intrusive freelist, and release() returns
+// every slab at once. The owning container must have destroyed all nodes
+// before calling release().
+template <class Node>
+class PoolNodeAllocator {
+ public:
+  static constexpr bool kBulkRelease = true;
+  static constexpr std::size_t kCacheLine = 64;
+  static constexpr std::size_t kMinSlabNodes = 16;
+  static constexpr std::size_t kMaxSlabNodes = 4096;
+
+  PoolNodeAllocator() = default;
+  PoolNodeAllocator(const PoolNodeAllocator&) = delete;
+  PoolNodeAllocator& operator=(const PoolNodeAllocator&) = delete;
+  ~PoolNodeAllocator() { release(); }
+
+  Node* allocate() {
+    ++stats_.node_allocations;
+    if (free_list_) {
+      FreeNode* node = free_list_;
+      free_list_ = node->next;
+      return reinterpret_cast<Node*>(node);
+    }
+    if (!slabs_ || slabs_->used == slabs_->capacity) {
+      add_slab();
+    }
+    return slot(slabs_, slabs_->used++);
+  }
+
+  void deallocate(Node* node) noexcept {
+    FreeNode* free_node = reinterpret_cast<FreeNode*>(node);
+    free_node->next = free_list_;
+    free_list_ = free_node;
+    ++stats_.node_deallocations;
+  }
+
+  // Returns all slabs to the system in one pass.
+  void release() noexcept {
+    while (slabs_) {
+      Slab* next = slabs_->next;
+      ::operator delete(static_cast<void*>(slabs_), std::align_val_t(kAlign));
+      ++stats_.system_deallocations;
+      slabs_ = next;
+    }
+    free_list_ = nullptr;
+    next_slab_nodes_ = kMinSlabNodes;
+  }
+
+  // Takes ownership of other's slabs, used when another container hands
+  // over all of its nodes (splice, merge).
+  void absorb(PoolNodeAllocator& other) noexcept {
+    if (&other == this || !other.slabs_) return;
+    Slab* last = other.slabs_;
+    while (last->next) last = last->next;
+    if (slabs_) {
+      // Keep our partially used slab at the head for bump allocation
+      last->next = slabs_->next;
+      slabs_->next = other.slabs_;
+    } else {
+      last->next = nullptr;
+      slabs_ = other.slabs_;
+    }
+    while (other.free_list_) {
+      FreeNode* node = other.free_list_;
+      other.free_list_ = node->next;
+      node->next = free_list_;
+      free_list_ = node;
+    }
+    other.slabs_ = nullptr;
+    other.next_slab_nodes_ = kMinSlabNodes;
+  }
+
+  void swap(PoolNodeAllocator& other) noexcept {
+    std::swap(slabs_, other.slabs_);
+    std::swap(free_list_, other.free_list_);
+    std::swap(next_slab_nodes_, other.next_slab_nodes_);
+    std::swap(stats_, other.stats_);
+  }
+
+  const AllocationStats& stats() const noexcept { return stats_; }
+
+ private:
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  struct Slab {
+    Slab* next;
+    std::size_t capacity;
+    std::size_t used;
+  };
+
+  static constexpr std::size_t kAlign =
+      alignof(Node) > kCacheLine ? alignof(Node) : kCacheLine;
+  static constexpr std::size_t kHeaderSize =
+      (sizeof(Slab) + kAlign - 1) / kAlign * kAlign;
+  static constexpr std::size_t kSlotSize =
+      sizeof(Node) > sizeof(FreeNode) ? sizeof(Node) : sizeof(FreeNode);
+
+  static Node* slot(Slab* slab, std::size_t index) noexcept {
+    return reinterpret_cast<Node*>(reinterpret_cast<char*>(slab) +
+                                   kHeaderSize + index * kSlotSize);
+  }
+
+  void add_slab() {
+    void* memory = ::operator new(kHeaderSize + next_slab_nodes_ * kSlotSize,
+                                  std::align_val_t(kAlign));
+    ++stats_.system_allocations;
+    Slab* slab = ::new (memory) Slab{slabs_, next_slab_nodes_, 0};
+    slabs_ = slab;
+    if (next_slab_nodes_ < kMaxSlabNodes) next_slab_nodes_ *= 2;
+  }
+
+  Slab* slabs_ = nullptr;  // Newest slab first, it serves bump allocation
+  FreeNode* free_list_ = nullptr;
+  std::size_t next_slab_nodes_ = kMinSlabNodes;
+  AllocationStats stats_;
+};
+
+// Node allocator over a std::pmr::memory_resource (s21::ArenaResource,
+// s21::PoolResource or a standard one). Nodes are returned one by one, so
+// the container works with any resource; with an arena the returns are
+// no-ops and the memory comes back on the arena's reset(). The resource
+// travels with the nodes on swap(); splice() and merge() hand nodes over
+// without copying, so both lists must use the same resource.
+template <class Node>
+class PmrNodeAllocator {
+ public:
+  static constexpr bool kBulkRelease = false;
+
+  PmrNodeAllocator() noexcept
+      : resource_(std::pmr::get_default_resource()) {}
+  PmrNodeAllocator(std::pmr::memory_resource* resource) noexcept
+      : resource_(resource) {}
+  template <class U>
+  PmrNodeAllocator(const std::pmr::polymorphic_allocator<U>& alloc) noexcept
+      : resource_(alloc.resource()) {}
+  PmrNodeAllocator(const PmrNodeAllocator&) = delete;
+  PmrNodeAllocator& operator=(const PmrNodeAllocator&) = delete;
+
+  Node* allocate() {
+    Node* node =
+        static_cast<Node*>(resource_->allocate(sizeof(Node), alignof(Node)));
+    ++stats_.node_allocations;
+    return node;
+  }
+
+  void deallocate(Node* node) noexcept {
+    resource_->deallocate(node, sizeof(Node), alignof(Node));
+    ++stats_.node_deallocations;
+  }
+
+  void release() noexcept {}
+  void absorb(PmrNodeAllocator&) noexcept {}
+  void swap(PmrNodeAllocator& other) noexcept {
+    std::swap(resource_, other.resource_);
+    std::swap(stats_, other.stats_);
+  }
+
+  std::pmr::memory_resource* resource() const noexcept { return resource_; }
+  const AllocationStats& stats() const noexcept { return stats_; }
+
+ private:
+  std::pmr::memory_resource* resource_;
+  AllocationStats stats_;
+};
+
+}  // namespace s21
+
+#endif  // S21_NODE_ALLOCATOR_H
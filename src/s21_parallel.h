@@ -0,0 +1,443 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "s21_thread_pool.h"
+#include "s21_vector.h"
+
+namespace s21 {
+namespace parallel {
+
+// Ranges this short are processed on the calling thread
+constexpr std::size_t kSequentialCutoff = std::size_t(1) << 14;
+// Upper bound on the pieces a range is split into. The split depends only on
+// the length of the range, never on the pool, so results (including the
+// rounding of floating-point reductions) are the same on any machine.
+constexpr std::size_t kMaxChunks = 256;
+
+// Pool shared by the overloads that do not take one, sized to the machine
+inline ThreadPool& default_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+namespace detail {
+
+inline std::size_t chunk_count(std::size_t n) {
+  const std::size_t chunks = (n + kSequentialCutoff - 1) / kSequentialCutoff;
+  return std::min(chunks, kMaxChunks);
+}
+
+inline std::size_t chunk_begin(std::size_t n, std::size_t chunks,
+                               std::size_t index) {
+  return n * index / chunks;
+}
+
+// Calls body(index, begin, end) for every chunk of [0, n); the calling
+// thread takes the first chunk and helps with the rest while it waits
+template <class Body>
+void for_chunks(ThreadPool& pool, std::size_t n, const Body& body) {
+  const std::size_t chunks = chunk_count(n);
+  if (chunks <= 1) {
+    if (n != 0) body(std::size_t(0), std::size_t(0), n);
+    return;
+  }
+  TaskGroup group(pool);
+  for (std::size_t i = 1; i < chunks; ++i) {
+    group.run([&body, n, chunks, i] {
+      body(i, chunk_begin(n, chunks, i), chunk_begin(n, chunks, i + 1));
+    });
+  }
+  body(std::size_t(0), std::size_t(0), chunk_begin(n, chunks, 1));
+  group.wait();
+}
+
+// Moves the sorted runs [first1, last1) and [first2, last2) into out. The
+// larger run is split at its middle element x and the other one at the
+// first element not less than x; the two halves merge independently.
+template <class InIt, class OutIt, class Compare>
+void merge_into(ThreadPool& pool, InIt first1, InIt last1, InIt first2,
+                InIt last2, OutIt out, Compare& comp) {
+  const std::size_t n1 = last1 - first1;
+  const std::size_t n2 = last2 - first2;
+  if (n1 + n2 <= kSequentialCutoff) {
+    std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+               std::make_move_iterator(first2), std::make_move_iterator(last2),
+               out, comp);
+    return;
+  }
+  InIt middle1;
+  InIt middle2;
+  if (n1 >= n2) {
+    middle1 = first1 + n1 / 2;
+    middle2 = std::lower_bound(first2, last2, *middle1, comp);
+  } else {
+    middle2 = first2 + n2 / 2;
+    middle1 = std::lower_bound(first1, last1, *middle2, comp);
+  }
+  const OutIt out_middle = out + ((middle1 - first1) + (middle2 - first2));
+  TaskGroup group(pool);
+  group.run([&pool, first1, middle1, first2, middle2, out, &comp] {
+    merge_into(pool, first1, middle1, first2, middle2, out, comp);
+  });
+  merge_into(pool, middle1, last1, middle2, last2, out_middle, comp);
+  group.wait();
+}
+
+// Sorts the n values in src. The result lands in tmp when into_tmp is set
+// and back in src otherwise; the levels alternate so every merge moves
+// between the two arrays instead of copying back.
+template <class SrcIt, class TmpIt, class Compare>
+void sort_into(ThreadPool& pool, SrcIt src, TmpIt tmp, std::size_t n,
+               bool into_tmp, Compare& comp) {
+  if (n <= kSequentialCutoff) {
+    std::sort(src, src + n, comp);
+    if (into_tmp) std::move(src, src + n, tmp);
+    return;
+  }
+  const std::size_t half = n / 2;
+  TaskGroup group(pool);
+  group.run([&pool, src, tmp, half, into_tmp, &comp] {
+    sort_into(pool, src, tmp, half, !into_tmp, comp);
+  });
+  sort_into(pool, src + half, tmp + half, n - half, !into_tmp, comp);
+  group.wait();
+  if (into_tmp) {
+    merge_into(pool, src, src + half, src + half, src + n, tmp, comp);
+  } else {
+    merge_into(pool, tmp, tmp + half, tmp + half, tmp + n, src, comp);
+  }
+}
+
+// Scratch array for sort, move-constructed from the input
+template <class T>
+class SortBuffer {
+ public:
+  template <class RandomIt>
+  SortBuffer(ThreadPool& pool, RandomIt first, std::size_t n)
+      : data_(std::allocator<T>().allocate(n)), size_(n) {
+    if constexpr (std::is_nothrow_move_constructible<T>::value) {
+      for_chunks(pool, n, [this, first](std::size_t, std::size_t begin,
+                                        std::size_t end) {
+        std::uninitialized_move(first + begin, first + end, data_ + begin);
+      });
+    } else {
+      try {
+        std::uninitialized_move(first, first + n, data_);
+      } catch (...) {
+        std::allocator<T>().deallocate(data_, n);
+        throw;
+      }
+    }
+  }
+  SortBuffer(const SortBuffer&) = delete;
+  SortBuffer& operator=(const SortBuffer&) = delete;
+  ~SortBuffer() {
+    std::destroy(data_, data_ + size_);
+    std::allocator<T>().deallocate(data_, size_);
+  }
+
+  T* data() const noexcept { return data_; }
+
+ private:
+  T* data_;
+  std::size_t size_;
+};
+
+// Positions [begin, end) of a partition that sit on the wrong side
+struct Run {
+  std::size_t begin;
+  std::size_t end;
+};
+
+// Walks the positions of consecutive nonempty runs, starting skip
+// positions in; the caller never reads past the last run
+class RunCursor {
+ public:
+  RunCursor(const Run* run, std::size_t skip) : run_(run), pos_(run->begin) {
+    while (skip >= run_->end - pos_) {
+      skip -= run_->end - pos_;
+      ++run_;
+      pos_ = run_->begin;
+    }
+    pos_ += skip;
+  }
+
+  std::size_t next() noexcept {
+    if (pos_ == run_->end) {
+      ++run_;
+      pos_ = run_->begin;
+    }
+    return pos_++;
+  }
+
+ private:
+  const Run* run_;
+  std::size_t pos_;
+};
+
+}  // namespace detail
+
+// Calls f on every element, chunks in parallel
+template <class RandomIt, class Function>
+void for_each(ThreadPool& pool, RandomIt first, RandomIt last, Function f) {
+  detail::for_chunks(pool, last - first,
+                     [first, &f](std::size_t, std::size_t begin,
+                                 std::size_t end) {
+                       std::for_each(first + begin, first + end, f);
+                     });
+}
+
+template <class RandomIt, class OutIt, class UnaryOp>
+OutIt transform(ThreadPool& pool, RandomIt first, RandomIt last,
+                OutIt d_first, UnaryOp op) {
+  const std::size_t n = last - first;
+  detail::for_chunks(pool, n,
+                     [first, d_first, &op](std::size_t, std::size_t begin,
+                                           std::size_t end) {
+                       std::transform(first + begin, first + end,
+                                      d_first + begin, op);
+                     });
+  return d_first + n;
+}
+
+template <class RandomIt1, class RandomIt2, class OutIt, class BinaryOp>
+OutIt transform(ThreadPool& pool, RandomIt1 first1, RandomIt1 last1,
+                RandomIt2 first2, OutIt d_first, BinaryOp op) {
+  const std::size_t n = last1 - first1;
+  detail::for_chunks(pool, n,
+                     [first1, first2, d_first, &op](
+                         std::size_t, std::size_t begin, std::size_t end) {
+                       std::transform(first1 + begin, first1 + end,
+                                      first2 + begin, d_first + begin, op);
+                     });
+  return d_first + n;
+}
+
+// Folds every chunk left to right, then folds init with the chunk results
+// in chunk order. op must be associative; it need not be commutative, and
+// the grouping depends only on the length of the range.
+template <class RandomIt, class T, class BinaryOp>
+T reduce(ThreadPool& pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op) {
+  const std::size_t n = last - first;
+  const std::size_t chunks = detail::chunk_count(n);
+  if (chunks <= 1) return std::accumulate(first, last, std::move(init), op);
+  s21::Vector<std::optional<T>> partials(chunks);
+  detail::for_chunks(pool, n,
+                     [first, &op, &partials](std::size_t index,
+                                             std::size_t begin,
+                                             std::size_t end) {
+                       T sum = first[begin];
+                       for (std::size_t i = begin + 1; i < end; ++i) {
+                         sum = op(std::move(sum), first[i]);
+                       }
+                       partials[index].emplace(std::move(sum));
+                     });
+  for (std::size_t i = 0; i < chunks; ++i) {
+    init = op(std::move(init), std::move(*partials[i]));
+  }
+  return init;
+}
+
+// Two passes: the chunk totals are reduced and prefixed in order, then
+// every chunk is scanned starting from the total of the chunks before it.
+// d_first may equal first.
+template <class RandomIt, class OutIt, class BinaryOp>
+OutIt inclusive_scan(ThreadPool& pool, RandomIt first, RandomIt last,
+                     OutIt d_first, BinaryOp op) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const std::size_t n = last - first;
+  const std::size_t chunks = detail::chunk_count(n);
+  if (chunks <= 1) return std::inclusive_scan(first, last, d_first, op);
+  // carry[i] is the total of chunks 0..i
+  s21::Vector<std::optional<T>> carry(chunks);
+  detail::for_chunks(pool, n,
+                     [first, &op, &carry, chunks](std::size_t index,
+                                                  std::size_t begin,
+                                                  std::size_t end) {
+                       if (index + 1 == chunks) return;  // Never read
+                       T sum = first[begin];
+                       for (std::size_t i = begin + 1; i < end; ++i) {
+                         sum = op(std::move(sum), first[i]);
+                       }
+                       carry[index].emplace(std::move(sum));
+                     });
+  for (std::size_t i = 1; i + 1 < chunks; ++i) {
+    carry[i].emplace(op(*carry[i - 1], std::move(*carry[i])));
+  }
+  detail::for_chunks(pool, n,
+                     [first, d_first, &op, &carry](std::size_t index,
+                                                   std::size_t begin,
+                                                   std::size_t end) {
+                       if (index == 0) {
+                         std::inclusive_scan(first, first + end, d_first, op);
+                       } else {
+                         std::inclusive_scan(first + begin, first + end,
+                                             d_first + begin, op,
+                                             *carry[index - 1]);
+                       }
+                     });
+  return d_first + n;
+}
+
+// Every chunk is partitioned in place, then the elements left on the wrong
+// side of the final boundary are paired up and swapped in parallel. Like
+// std::partition, the relative order of elements is not kept.
+template <class RandomIt, class UnaryPredicate>
+RandomIt partition(ThreadPool& pool, RandomIt first, RandomIt last,
+                   UnaryPredicate pred) {
+  const std::size_t n = last - first;
+  const std::size_t chunks = detail::chunk_count(n);
+  if (chunks <= 1) return std::partition(first, last, pred);
+  s21::Vector<std::size_t> splits(chunks);
+  detail::for_chunks(pool, n,
+                     [first, &pred, &splits](std::size_t index,
+                                             std::size_t begin,
+                                             std::size_t end) {
+                       splits[index] =
+                           std::partition(first + begin, first + end, pred) -
+                           first;
+                     });
+  std::size_t boundary = 0;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    boundary += splits[i] - detail::chunk_begin(n, chunks, i);
+  }
+  // Runs of false elements before the boundary and of true ones after it,
+  // in position order; both hold the same number of elements
+  s21::Vector<detail::Run> misplaced_false;
+  s21::Vector<detail::Run> misplaced_true;
+  std::size_t misplaced = 0;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    const std::size_t begin = detail::chunk_begin(n, chunks, i);
+    const std::size_t end = detail::chunk_begin(n, chunks, i + 1);
+    const std::size_t false_end = std::min(end, boundary);
+    if (splits[i] < false_end) {
+      misplaced_false.push_back(detail::Run{splits[i], false_end});
+      misplaced += false_end - splits[i];
+    }
+    if (std::max(begin, boundary) < splits[i]) {
+      misplaced_true.push_back(
+          detail::Run{std::max(begin, boundary), splits[i]});
+    }
+  }
+  // The k-th misplaced false element trades places with the k-th true one
+  detail::for_chunks(pool, misplaced,
+                     [first, &misplaced_false, &misplaced_true](
+                         std::size_t, std::size_t from, std::size_t to) {
+                       detail::RunCursor f(misplaced_false.data(), from);
+                       detail::RunCursor t(misplaced_true.data(), from);
+                       for (std::size_t k = from; k < to; ++k) {
+                         std::iter_swap(first + f.next(), first + t.next());
+                       }
+                     });
+  return first + boundary;
+}
+
+// Parallel merge sort: leaves of kSequentialCutoff elements are sorted with
+// std::sort, merges split recursively. Needs a scratch copy of the range;
+// not stable.
+template <class RandomIt, class Compare>
+void sort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  const std::size_t n = last - first;
+  if (n <= kSequentialCutoff) {
+    std::sort(first, last, comp);
+    return;
+  }
+  // The values move to the buffer and the final merge moves them back
+  detail::SortBuffer<T> buffer(pool, first, n);
+  detail::sort_into(pool, buffer.data(), first, n, true, comp);
+}
+
+template <class RandomIt>
+void sort(ThreadPool& pool, RandomIt first, RandomIt last) {
+  parallel::sort(pool, first, last, std::less<>());
+}
+
+template <class RandomIt>
+typename std::iterator_traits<RandomIt>::value_type reduce(ThreadPool& pool,
+                                                           RandomIt first,
+                                                           RandomIt last) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  return parallel::reduce(pool, first, last, T(), std::plus<>());
+}
+
+template <class RandomIt, class OutIt>
+OutIt inclusive_scan(ThreadPool& pool, RandomIt first, RandomIt last,
+                     OutIt d_first) {
+  return parallel::inclusive_scan(pool, first, last, d_first, std::plus<>());
+}
+
+// The same algorithms on default_pool()
+
+template <class RandomIt, class Function>
+void for_each(RandomIt first, RandomIt last, Function f) {
+  parallel::for_each(default_pool(), first, last, std::move(f));
+}
+
+template <class RandomIt, class OutIt, class UnaryOp>
+OutIt transform(RandomIt first, RandomIt last, OutIt d_first, UnaryOp op) {
+  return parallel::transform(default_pool(), first, last, d_first,
+                             std::move(op));
+}
+
+template <class RandomIt1, class RandomIt2, class OutIt, class BinaryOp>
+OutIt transform(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2,
+                OutIt d_first, BinaryOp op) {
+  return parallel::transform(default_pool(), first1, last1, first2, d_first,
+                             std::move(op));
+}
+
+template <class RandomIt, class T, class BinaryOp>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op) {
+  return parallel::reduce(default_pool(), first, last, std::move(init),
+                          std::move(op));
+}
+
+template <class RandomIt>
+typename std::iterator_traits<RandomIt>::value_type reduce(RandomIt first,
+                                                           RandomIt last) {
+  return parallel::reduce(default_pool(), first, last);
+}
+
+template <class RandomIt, class OutIt, class BinaryOp>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt d_first,
+                     BinaryOp op) {
+  return parallel::inclusive_scan(default_pool(), first, last, d_first,
+                                  std::move(op));
+}
+
+template <class RandomIt, class OutIt>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt d_first) {
+  return parallel::inclusive_scan(default_pool(), first, last, d_first);
+}
+
+template <class RandomIt, class UnaryPredicate>
+RandomIt partition(RandomIt first, RandomIt last, UnaryPredicate pred) {
+  return parallel::partition(default_pool(), first, last, std::move(pred));
+}
+
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp) {
+  parallel::sort(default_pool(), first, last, std::move(comp));
+}
+
+template <class RandomIt>
+void sort(RandomIt first, RandomIt last) {
+  parallel::sort(default_pool(), first, last);
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // S21_PARALLEL_H
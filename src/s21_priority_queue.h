@@ -0,0 +1,443 @@
+#ifndef S21_PRIORITY_QUEUE_H
+#define S21_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace heap_detail {
+
+// Implicit d-ary heap in a random-access range: the children of slot i are
+// slots i * Arity + 1 .. i * Arity + Arity. comp(a, b) means a sits below b,
+// so the top is a greatest element, as in std::priority_queue. Every helper
+// reports where it put an element through track(element, index), which the
+// indexed queue uses to keep its id -> slot table current.
+
+struct NoTracking {
+  template <class T>
+  void operator()(const T&, std::size_t) const noexcept {}
+};
+
+template <std::size_t Arity>
+constexpr std::size_t parent(std::size_t i) {
+  return (i - 1) / Arity;
+}
+
+// Moves the parents of the hole down until value fits, then puts it there
+template <std::size_t Arity, class RandomIt, class T, class Compare,
+          class Track>
+void sift_up(RandomIt first, std::size_t hole, T value, Compare& comp,
+             Track& track) {
+  while (hole > 0) {
+    const std::size_t up = parent<Arity>(hole);
+    if (!comp(first[up], value)) break;
+    first[hole] = std::move(first[up]);
+    track(first[hole], hole);
+    hole = up;
+  }
+  first[hole] = std::move(value);
+  track(first[hole], hole);
+}
+
+// Moves the greatest child of the hole up until value fits among n slots
+template <std::size_t Arity, class RandomIt, class T, class Compare,
+          class Track>
+void sift_down(RandomIt first, std::size_t n, std::size_t hole, T value,
+               Compare& comp, Track& track) {
+  while (true) {
+    const std::size_t child = hole * Arity + 1;
+    if (child >= n) break;
+    const std::size_t last = n - child < Arity ? n : child + Arity;
+    std::size_t best = child;
+    for (std::size_t i = child + 1; i < last; ++i) {
+      if (comp(first[best], first[i])) best = i;
+    }
+    if (!comp(value, first[best])) break;
+    first[hole] = std::move(first[best]);
+    track(first[hole], hole);
+    hole = best;
+  }
+  first[hole] = std::move(value);
+  track(first[hole], hole);
+}
+
+// Floyd's bottom-up construction: O(n) comparisons and moves
+template <std::size_t Arity, class RandomIt, class Compare, class Track>
+void make_heap(RandomIt first, std::size_t n, Compare& comp, Track& track) {
+  if (n < 2) return;
+  for (std::size_t i = parent<Arity>(n - 1) + 1; i-- > 0;) {
+    auto value = std::move(first[i]);
+    sift_down<Arity>(first, n, i, std::move(value), comp, track);
+  }
+}
+
+// Depth of a heap of n elements, the cost of one sift in moves
+template <std::size_t Arity>
+std::size_t depth(std::size_t n) {
+  std::size_t levels = 0;
+  for (; n > 0; n /= Arity) ++levels;
+  return levels;
+}
+
+}  // namespace heap_detail
+
+// Priority queue adapter over an implicit d-ary heap. A wider node (Arity 4
+// or 8) halves or thirds the depth of the heap and keeps the children of a
+// node in one or two cache lines, which pays off for pop-heavy workloads.
+// Container must be random access and provide push_back, pop_back, back,
+// size, empty and swap; s21::Vector qualifies.
+template <class T, class Compare = std::less<T>,
+          class Container = s21::Vector<T>, std::size_t Arity = 4>
+class PriorityQueue {
+ public:
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+  PriorityQueue() = default;
+  explicit PriorityQueue(const Compare& comp) : comp_(comp) {}
+  // Takes over items and heapifies them in O(n)
+  PriorityQueue(const Compare& comp, Container&& items);
+  template <class InputIt>
+  PriorityQueue(InputIt first, InputIt last, const Compare& comp = Compare());
+  PriorityQueue(std::initializer_list<value_type> const& items);
+  // Passes alloc (e.g. a std::pmr::memory_resource*) to the container
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  explicit PriorityQueue(const Alloc& alloc) : container_(alloc) {}
+
+  const_reference top() const;
+
+  bool empty() const noexcept { return container_.empty(); }
+  size_type size() const noexcept { return container_.size(); }
+
+  void push(const_reference value);
+  void push(value_type&& value);
+  // Appends the range; rebuilds the heap in O(n) when that is cheaper than
+  // sifting every new element up
+  template <class InputIt>
+  void push_many(InputIt first, InputIt last);
+
+  void pop();
+  // Moves up to k greatest elements to out in priority order and pops them
+  template <class OutputIt>
+  OutputIt pop_top_k(size_type k, OutputIt out);
+
+  void swap(PriorityQueue& other) noexcept;
+  value_compare value_comp() const { return comp_; }
+
+ private:
+  void check_not_empty(const char* operation) const;
+
+  Container container_;
+  Compare comp_;
+};
+
+template <class T, class Compare, class Container, std::size_t Arity>
+PriorityQueue<T, Compare, Container, Arity>::PriorityQueue(
+    const Compare& comp, Container&& items)
+    : container_(std::move(items)), comp_(comp) {
+  heap_detail::NoTracking track;
+  heap_detail::make_heap<Arity>(container_.begin(), container_.size(), comp_,
+                                track);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+template <class InputIt>
+PriorityQueue<T, Compare, Container, Arity>::PriorityQueue(InputIt first,
+                                                           InputIt last,
+                                                           const Compare& comp)
+    : comp_(comp) {
+  push_many(first, last);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+PriorityQueue<T, Compare, Container, Arity>::PriorityQueue(
+    std::initializer_list<value_type> const& items) {
+  push_many(items.begin(), items.end());
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void PriorityQueue<T, Compare, Container, Arity>::check_not_empty(
+    const char* operation) const {
+  if (empty()) {
+    throw std::runtime_error(std::string(operation) +
+                             " called on empty priority queue");
+  }
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+typename PriorityQueue<T, Compare, Container, Arity>::const_reference
+PriorityQueue<T, Compare, Container, Arity>::top() const {
+  check_not_empty("top");
+  return *container_.begin();
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void PriorityQueue<T, Compare, Container, Arity>::push(const_reference value) {
+  push(value_type(value));
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void PriorityQueue<T, Compare, Container, Arity>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+  // Lift the new element out of its slot and let the sift place it
+  const size_type hole = container_.size() - 1;
+  value_type moved = std::move(container_.begin()[hole]);
+  heap_detail::NoTracking track;
+  heap_detail::sift_up<Arity>(container_.begin(), hole, std::move(moved),
+                              comp_, track);
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+template <class InputIt>
+void PriorityQueue<T, Compare, Container, Arity>::push_many(InputIt first,
+                                                            InputIt last) {
+  const size_type old_size = container_.size();
+  for (; first != last; ++first) container_.push_back(*first);
+  const size_type new_size = container_.size();
+  heap_detail::NoTracking track;
+  if ((new_size - old_size) * heap_detail::depth<Arity>(new_size) >
+      new_size) {
+    heap_detail::make_heap<Arity>(container_.begin(), new_size, comp_, track);
+    return;
+  }
+  for (size_type i = old_size; i < new_size; ++i) {
+    value_type moved = std::move(container_.begin()[i]);
+    heap_detail::sift_up<Arity>(container_.begin(), i, std::move(moved), comp_,
+                                track);
+  }
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void PriorityQueue<T, Compare, Container, Arity>::pop() {
+  check_not_empty("pop");
+  value_type last = std::move(container_.begin()[container_.size() - 1]);
+  container_.pop_back();
+  if (!container_.empty()) {
+    heap_detail::NoTracking track;
+    heap_detail::sift_down<Arity>(container_.begin(), container_.size(), 0,
+                                  std::move(last), comp_, track);
+  }
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+template <class OutputIt>
+OutputIt PriorityQueue<T, Compare, Container, Arity>::pop_top_k(size_type k,
+                                                                OutputIt out) {
+  for (; k > 0 && !container_.empty(); --k) {
+    *out = std::move(*container_.begin());
+    ++out;
+    pop();
+  }
+  return out;
+}
+
+template <class T, class Compare, class Container, std::size_t Arity>
+void PriorityQueue<T, Compare, Container, Arity>::swap(
+    PriorityQueue& other) noexcept {
+  using std::swap;
+  container_.swap(other.container_);
+  swap(comp_, other.comp_);
+}
+
+// Priority queue over the ids 0, 1, 2, ... that can find any queued id and
+// change its priority in O(log n), as Dijkstra's and Prim's algorithms and
+// deadline schedulers need. The heap stores (priority, id) entries next to
+// each other, so sifting never leaves the heap array, and a side table
+// maps every id to its slot. By default the smallest priority is on top,
+// and decrease_key moves an id towards the top. The table grows to the
+// largest id pushed, so ids should be dense.
+template <class Priority, class Compare = std::greater<Priority>,
+          std::size_t Arity = 4>
+class IndexedPriorityQueue {
+ public:
+  using priority_type = Priority;
+  using value_compare = Compare;
+  using size_type = std::size_t;
+
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+  IndexedPriorityQueue() = default;
+  // Reserves the id table for ids below id_count
+  explicit IndexedPriorityQueue(size_type id_count,
+                                const Compare& comp = Compare());
+
+  bool empty() const noexcept { return heap_.empty(); }
+  size_type size() const noexcept { return heap_.size(); }
+  bool contains(size_type id) const noexcept {
+    return id < slots_.size() && slots_[id] != kAbsent;
+  }
+
+  size_type top() const;
+  const priority_type& top_priority() const;
+  const priority_type& priority(size_type id) const;
+
+  // Throws std::invalid_argument if id is already queued
+  void push(size_type id, const priority_type& priority);
+  void pop();
+  // Moves id towards the top; throws std::invalid_argument if the new
+  // priority would move it down or id is not queued
+  void decrease_key(size_type id, const priority_type& priority);
+  // Sets any priority, moving id whichever way it needs to go
+  void update(size_type id, const priority_type& priority);
+  // Removes id if it is queued; returns whether it was
+  bool erase(size_type id);
+
+ private:
+  struct Entry {
+    priority_type priority;
+    size_type id;
+  };
+
+  // Orders entries by priority only
+  struct EntryCompare {
+    bool operator()(const Entry& a, const Entry& b) {
+      return comp(a.priority, b.priority);
+    }
+    Compare comp;
+  };
+
+  struct SlotTracking {
+    void operator()(const Entry& entry, size_type slot) noexcept {
+      (*slots)[entry.id] = slot;
+    }
+    s21::Vector<size_type>* slots;
+  };
+
+  static constexpr size_type kAbsent = std::numeric_limits<size_type>::max();
+
+  size_type slot_of(size_type id) const;
+  void reposition(size_type slot, Entry entry);
+
+  s21::Vector<Entry> heap_;
+  s21::Vector<size_type> slots_;
+  EntryCompare comp_{};
+};
+
+template <class Priority, class Compare, std::size_t Arity>
+IndexedPriorityQueue<Priority, Compare, Arity>::IndexedPriorityQueue(
+    size_type id_count, const Compare& comp)
+    : slots_(id_count), comp_{comp} {
+  for (size_type& slot : slots_) slot = kAbsent;
+  heap_.reserve(id_count);
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+typename IndexedPriorityQueue<Priority, Compare, Arity>::size_type
+IndexedPriorityQueue<Priority, Compare, Arity>::slot_of(size_type id) const {
+  if (!contains(id)) {
+    throw std::invalid_argument("id is not in the priority queue");
+  }
+  return slots_[id];
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+typename IndexedPriorityQueue<Priority, Compare, Arity>::size_type
+IndexedPriorityQueue<Priority, Compare, Arity>::top() const {
+  if (empty()) throw std::runtime_error("top called on empty priority queue");
+  return heap_[0].id;
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+const typename IndexedPriorityQueue<Priority, Compare, Arity>::priority_type&
+IndexedPriorityQueue<Priority, Compare, Arity>::top_priority() const {
+  if (empty()) {
+    throw std::runtime_error("top_priority called on empty priority queue");
+  }
+  return heap_[0].priority;
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+const typename IndexedPriorityQueue<Priority, Compare, Arity>::priority_type&
+IndexedPriorityQueue<Priority, Compare, Arity>::priority(size_type id) const {
+  return heap_[slot_of(id)].priority;
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+void IndexedPriorityQueue<Priority, Compare, Arity>::push(
+    size_type id, const priority_type& priority) {
+  if (contains(id)) {
+    throw std::invalid_argument("id is already in the priority queue");
+  }
+  if (id == kAbsent) throw std::length_error("priority queue id too large");
+  if (id >= slots_.size()) {
+    slots_.reserve(id + 1);
+    while (slots_.size() <= id) slots_.push_back(kAbsent);
+  }
+  heap_.push_back(Entry{priority, id});
+  SlotTracking track{&slots_};
+  Entry entry = heap_.back();
+  heap_detail::sift_up<Arity>(heap_.begin(), heap_.size() - 1,
+                              std::move(entry), comp_, track);
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+void IndexedPriorityQueue<Priority, Compare, Arity>::pop() {
+  if (empty()) throw std::runtime_error("pop called on empty priority queue");
+  erase(heap_[0].id);
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+void IndexedPriorityQueue<Priority, Compare, Arity>::decrease_key(
+    size_type id, const priority_type& priority) {
+  const size_type slot = slot_of(id);
+  if (comp_.comp(priority, heap_[slot].priority)) {
+    throw std::invalid_argument("decrease_key would move the id down");
+  }
+  SlotTracking track{&slots_};
+  heap_detail::sift_up<Arity>(heap_.begin(), slot, Entry{priority, id}, comp_,
+                              track);
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+void IndexedPriorityQueue<Priority, Compare, Arity>::update(
+    size_type id, const priority_type& priority) {
+  reposition(slot_of(id), Entry{priority, id});
+}
+
+template <class Priority, class Compare, std::size_t Arity>
+bool IndexedPriorityQueue<Priority, Compare, Arity>::erase(size_type id) {
+  if (!contains(id)) return false;
+  const size_type slot = slots_[id];
+  slots_[id] = kAbsent;
+  Entry last = std::move(heap_[heap_.size() - 1]);
+  heap_.pop_back();
+  if (slot < heap_.size()) reposition(slot, std::move(last));
+  return true;
+}
+
+// Puts entry into slot, whose old entry is gone, and restores the heap
+template <class Priority, class Compare, std::size_t Arity>
+void IndexedPriorityQueue<Priority, Compare, Arity>::reposition(size_type slot,
+                                                                Entry entry) {
+  SlotTracking track{&slots_};
+  if (slot > 0 &&
+      comp_(heap_[heap_detail::parent<Arity>(slot)], entry)) {
+    heap_detail::sift_up<Arity>(heap_.begin(), slot, std::move(entry), comp_,
+                                track);
+  } else {
+    heap_detail::sift_down<Arity>(heap_.begin(), heap_.size(), slot,
+                                  std::move(entry), comp_, track);
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_PRIORITY_QUEUE_H
@@ -1,18 +1,31 @@
 #ifndef Containers_Queue_H
 #define Containers_Queue_H
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_deque.h"
 #include "s21_list.h"
 
 namespace s21 {
 
-template <class T>
+// Container must provide push_back, emplace_back, pop_front, front, back,
+// size, empty and swap; s21::Deque (ring buffer) and s21::List both
+// qualify.
+template <class T, class Container = s21::Deque<T>>
 class Queue {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
 
   Queue();
+  // Passes alloc (e.g. a std::pmr::memory_resource*) to the container
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  explicit Queue(const Alloc& alloc) : container_(alloc) {}
   Queue(std::initializer_list<value_type> const& items);
   Queue(const Queue& q);
   Queue(Queue&& q);
@@ -25,78 +38,103 @@ class Queue {
   inline bool empty() const noexcept;
   inline size_type size() const noexcept;
 
-  inline void push(const_reference value) noexcept;
-  inline void pop() noexcept;
+  inline void push(const_reference value);
+  inline void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  // Pushes every argument in order
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+  inline void pop();
   inline void swap(Queue& other) noexcept;
 
  private:
-  s21::List<T> container_;
+  Container container_;
 };
 
-template <class T>
-Queue<T>::Queue() {}
+template <class T, class Container>
+Queue<T, Container>::Queue() {}
 
-template <class T>
-Queue<T>::~Queue() {}
+template <class T, class Container>
+Queue<T, Container>::~Queue() {}
 
-template <class T>
-Queue<T>::Queue(std::initializer_list<value_type> const& items) {
-  container_.assign(items);
+template <class T, class Container>
+Queue<T, Container>::Queue(std::initializer_list<value_type> const& items) {
+  for (const auto& item : items) container_.push_back(item);
 }
 
-template <class T>
-Queue<T>::Queue(const Queue& q) {
-  s21::List<T> buf(q.container_);
-  container_.swap(buf);
-}
+template <class T, class Container>
+Queue<T, Container>::Queue(const Queue& q) : container_(q.container_) {}
 
-template <class T>
-Queue<T>::Queue(Queue&& q) {
-  container_.swap(q.container_);
-}
+template <class T, class Container>
+Queue<T, Container>::Queue(Queue&& q) : container_(std::move(q.container_)) {}
 
-template <class T>
-Queue<T>& Queue<T>::operator=(Queue&& q) {
+template <class T, class Container>
+Queue<T, Container>& Queue<T, Container>::operator=(Queue&& q) {
   if (&q != this) {
-    container_.clear();
-    container_.swap(q.container_);
+    container_ = std::move(q.container_);
   }
   return *this;
 }
 
-template <class T>
-inline typename Queue<T>::const_reference Queue<T>::front() const {
+template <class T, class Container>
+inline typename Queue<T, Container>::const_reference
+Queue<T, Container>::front() const {
   return container_.front();
 }
 
-template <class T>
-inline typename Queue<T>::const_reference Queue<T>::back() const {
+template <class T, class Container>
+inline typename Queue<T, Container>::const_reference
+Queue<T, Container>::back() const {
   return container_.back();
 }
-template <class T>
-inline bool Queue<T>::empty() const noexcept {
+template <class T, class Container>
+inline bool Queue<T, Container>::empty() const noexcept {
   return container_.empty();
 }
 
-template <class T>
-inline typename Queue<T>::size_type Queue<T>::size() const noexcept {
+template <class T, class Container>
+inline typename Queue<T, Container>::size_type Queue<T, Container>::size()
+    const noexcept {
   return container_.size();
 }
 
-template <class T>
-inline void Queue<T>::push(const_reference value) noexcept {
+template <class T, class Container>
+inline void Queue<T, Container>::push(const_reference value) {
   container_.push_back(value);
 }
 
-template <class T>
-inline void Queue<T>::pop() noexcept {
+template <class T, class Container>
+inline void Queue<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+}
+
+template <class T, class Container>
+template <class... Args>
+void Queue<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T, class Container>
+template <class... Args>
+void Queue<T, Container>::insert_many_back(Args&&... args) {
+  (container_.emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class T, class Container>
+inline void Queue<T, Container>::pop() {
   container_.pop_front();
 }
 
-template <class T>
-inline void Queue<T>::swap(Queue& other) noexcept {
+template <class T, class Container>
+inline void Queue<T, Container>::swap(Queue& other) noexcept {
   container_.swap(other.container_);
 }
+namespace pmr {
+template <class T>
+using Queue = s21::Queue<T, pmr::Deque<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // !Containers_Queue_H
\ No newline at end of file
@@ -1,134 +1,359 @@
 #include "s21_set.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
 namespace s21 {
 
-// Конструктор по умолчанию
-template <typename Key>
-Set<Key>::Set() : map_() {}
+namespace {
 
-// Конструктор с инициализатором списка
+// Список указателей на элементы, который читается как последовательность
+// самих элементов: узлы результата копируются прямо из исходных деревьев
+template <typename Item>
+class ItemIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Item;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Item*;
+  using reference = const Item&;
+
+  explicit ItemIterator(const Item* const* pos) : pos_(pos) {}
+
+  reference operator*() const { return **pos_; }
+  pointer operator->() const { return *pos_; }
+  ItemIterator& operator++() {
+    ++pos_;
+    return *this;
+  }
+  ItemIterator operator++(int) {
+    ItemIterator old = *this;
+    ++pos_;
+    return old;
+  }
+  bool operator==(const ItemIterator& other) const {
+    return pos_ == other.pos_;
+  }
+  bool operator!=(const ItemIterator& other) const {
+    return pos_ != other.pos_;
+  }
+
+ private:
+  const Item* const* pos_;
+};
+
+// Список указателей на ключи, который читается как пары узлов Set: ключ
+// копируется прямо в узел, без промежуточной пары
 template <typename Key>
-Set<Key>::Set(std::initializer_list<value_type> const& items) {
-  for (const auto& item : items) {
-    insert(item);
+class KeyIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::pair<const Key&, const Key&>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+
+  explicit KeyIterator(const Key* const* pos) : pos_(pos) {}
+
+  reference operator*() const { return reference(**pos_, **pos_); }
+  KeyIterator& operator++() {
+    ++pos_;
+    return *this;
   }
+  KeyIterator operator++(int) {
+    KeyIterator old = *this;
+    ++pos_;
+    return old;
+  }
+  bool operator==(const KeyIterator& other) const {
+    return pos_ == other.pos_;
+  }
+  bool operator!=(const KeyIterator& other) const {
+    return pos_ != other.pos_;
+  }
+
+ private:
+  const Key* const* pos_;
+};
+
+}  // namespace
+
+// Конструктор по умолчанию
+template <typename Key, typename A>
+Set<Key, A>::Set() : map_() {}
+
+// Конструктор с аллокатором
+template <typename Key, typename A>
+Set<Key, A>::Set(const allocator_type& alloc) : map_(alloc) {}
+
+// Конструктор с инициализатором списка
+template <typename Key, typename A>
+Set<Key, A>::Set(std::initializer_list<value_type> const& items,
+                 const allocator_type& alloc)
+    : map_(alloc) {
+  // Список сортируется по указателям и строится сразу сбалансированным
+  // деревом; из равных ключей, как и при поочередной вставке, остается
+  // первый
+  s21::Vector<const Key*> keys;
+  keys.reserve(items.size());
+  for (const auto& item : items) keys.push_back(&item);
+  std::stable_sort(keys.begin(), keys.end(),
+                   [](const Key* a, const Key* b) { return *a < *b; });
+  keys.erase(std::unique(keys.begin(), keys.end(),
+                         [](const Key* a, const Key* b) { return !(*a < *b); }),
+             keys.end());
+  map_.assign_sorted(KeyIterator<Key>(keys.data()),
+                     KeyIterator<Key>(keys.data() + keys.size()));
 }
 
 // Копирующий конструктор
-template <typename Key>
-Set<Key>::Set(const Set& other) : map_(other.map_) {}
+template <typename Key, typename A>
+Set<Key, A>::Set(const Set& other) : map_(other.map_) {}
 
 // Перемещающий конструктор
-template <typename Key>
-Set<Key>::Set(Set&& other) noexcept : map_(std::move(other.map_)) {}
+template <typename Key, typename A>
+Set<Key, A>::Set(Set&& other) noexcept : map_(std::move(other.map_)) {}
 
 // Деструктор
-template <typename Key>
-Set<Key>::~Set() {}
+template <typename Key, typename A>
+Set<Key, A>::~Set() {}
 
 // Оператор присваивания перемещением
-template <typename Key>
-Set<Key>& Set<Key>::operator=(Set&& other) noexcept {
+template <typename Key, typename A>
+Set<Key, A>& Set<Key, A>::operator=(Set&& other) {
   if (this != &other) {
     map_ = std::move(other.map_);
   }
   return *this;
 }
 
-template <typename Key>
-Set<Key>& Set<Key>::operator=(const Set<Key>& other) {
+template <typename Key, typename A>
+Set<Key, A>& Set<Key, A>::operator=(const Set<Key, A>& other) {
   if (this != &other) {
-    map_.clear();  // Clear current map content
-    for (const auto& pair : other.map_) {
-      map_.insert(pair);  // Insert elements from other's map
-    }
+    map_ = other.map_;
   }
   return *this;
 }
 
+template <typename Key, typename A>
+typename Set<Key, A>::allocator_type Set<Key, A>::get_allocator() const {
+  return allocator_type(map_.get_allocator());
+}
+
 // Проверка на пустоту
-template <typename Key>
-bool Set<Key>::empty() const noexcept {
+template <typename Key, typename A>
+bool Set<Key, A>::empty() const noexcept {
   return map_.empty();
 }
 
 // Возвращает количество элементов
-template <typename Key>
-typename Set<Key>::size_type Set<Key>::size() const noexcept {
+template <typename Key, typename A>
+typename Set<Key, A>::size_type Set<Key, A>::size() const noexcept {
   return map_.size();
 }
 
 // Возвращает максимальное количество элементов
-template <typename Key>
-typename Set<Key>::size_type Set<Key>::max_size() const noexcept {
+template <typename Key, typename A>
+typename Set<Key, A>::size_type Set<Key, A>::max_size() const noexcept {
   return map_.max_size();
 }
 
 // Очистка множества
-template <typename Key>
-void Set<Key>::clear() noexcept {
+template <typename Key, typename A>
+void Set<Key, A>::clear() noexcept {
   map_.clear();
 }
 
 // Вставка элемента
-template <typename Key>
-std::pair<typename Set<Key>::iterator, bool> Set<Key>::insert(
+template <typename Key, typename A>
+std::pair<typename Set<Key, A>::iterator, bool> Set<Key, A>::insert(
     const value_type& value) {
-  auto result = map_.insert(std::make_pair(value, value));
-  return {result.first, result.second};
+  return map_.try_emplace(value, value);
+}
+
+// Вставка перемещением: значение переносится в узел без копии
+template <typename Key, typename A>
+std::pair<typename Set<Key, A>::iterator, bool> Set<Key, A>::insert(
+    value_type&& value) {
+  return map_.try_emplace(value, std::move(value));
 }
 
 // Удаление элемента по итератору
-template <typename Key>
-void Set<Key>::erase(iterator pos) {
+template <typename Key, typename A>
+void Set<Key, A>::erase(iterator pos) {
   map_.erase(pos);
 }
 
 // Обмен содержимым
-template <typename Key>
-void Set<Key>::swap(Set& other) noexcept {
+template <typename Key, typename A>
+void Set<Key, A>::swap(Set& other) noexcept {
   map_.swap(other.map_);
 }
 
-// Слияние множеств
-// Слияние множеств
-template <typename Key>
-void Set<Key>::merge(Set<Key>& other) {
+// Слияние множеств: узлы переносятся без копирования, элементы,
+// уже присутствующие в текущем множестве, остаются в other
+template <typename Key, typename A>
+void Set<Key, A>::merge(Set<Key, A>& other) {
   map_.merge(other.map_);
-  other.map_.clear();  // Optionally clear `other` after merging if desired
 }
 
-// Поиск элемента
-// Поиск элемента (константная версия)
-// Поиск элемента по ключу
-template <typename Key>
-typename Set<Key>::iterator Set<Key>::find(const Key& key) {
-  auto it = map_.begin();
-  while (it != map_.end()) {
-    if (it->first == key) {  // Сравниваем ключи
-      return iterator(it);
+// Объединение: из совпадающих элементов берется элемент текущего множества
+template <typename Key, typename A>
+Set<Key, A> Set<Key, A>::set_union(const Set& other) const {
+  ItemList items;
+  items.reserve(size() + other.size());
+  auto i = map_.begin();
+  auto j = other.map_.begin();
+  const auto i_end = map_.end();
+  const auto j_end = other.map_.end();
+  while (i != i_end && j != j_end) {
+    if (i->first < j->first) {
+      items.push_back(&*i++);
+    } else if (j->first < i->first) {
+      items.push_back(&*j++);
+    } else {
+      items.push_back(&*i++);
+      ++j;
+    }
+  }
+  for (; i != i_end; ++i) items.push_back(&*i);
+  for (; j != j_end; ++j) items.push_back(&*j);
+  return from_items(items);
+}
+
+// Пересечение: линейный проход или поиск элементов меньшего множества
+// в большем, если второе намного больше
+template <typename Key, typename A>
+Set<Key, A> Set<Key, A>::set_intersection(const Set& other) const {
+  const Set& small = size() <= other.size() ? *this : other;
+  const Set& large = size() <= other.size() ? other : *this;
+  ItemList items;
+  items.reserve(small.size());
+  if (lookup_is_cheaper(small.size(), large.size())) {
+    for (const Item& item : small.map_) {
+      if (large.map_.contains(item.first)) items.push_back(&item);
+    }
+    return from_items(items);
+  }
+  auto i = map_.begin();
+  auto j = other.map_.begin();
+  const auto i_end = map_.end();
+  const auto j_end = other.map_.end();
+  while (i != i_end && j != j_end) {
+    if (i->first < j->first) {
+      ++i;
+    } else if (j->first < i->first) {
+      ++j;
+    } else {
+      items.push_back(&*i++);
+      ++j;
+    }
+  }
+  return from_items(items);
+}
+
+// Разность: элементы текущего множества, которых нет в other
+template <typename Key, typename A>
+Set<Key, A> Set<Key, A>::set_difference(const Set& other) const {
+  ItemList items;
+  items.reserve(size());
+  if (lookup_is_cheaper(size(), other.size())) {
+    for (const Item& item : map_) {
+      if (!other.map_.contains(item.first)) items.push_back(&item);
+    }
+    return from_items(items);
+  }
+  auto i = map_.begin();
+  auto j = other.map_.begin();
+  const auto i_end = map_.end();
+  const auto j_end = other.map_.end();
+  while (i != i_end && j != j_end) {
+    if (i->first < j->first) {
+      items.push_back(&*i++);
+    } else if (j->first < i->first) {
+      ++j;
+    } else {
+      ++i;
+      ++j;
+    }
+  }
+  for (; i != i_end; ++i) items.push_back(&*i);
+  return from_items(items);
+}
+
+// Симметрическая разность: элементы, входящие ровно в одно из множеств
+template <typename Key, typename A>
+Set<Key, A> Set<Key, A>::set_symmetric_difference(const Set& other) const {
+  ItemList items;
+  items.reserve(size() + other.size());
+  auto i = map_.begin();
+  auto j = other.map_.begin();
+  const auto i_end = map_.end();
+  const auto j_end = other.map_.end();
+  while (i != i_end && j != j_end) {
+    if (i->first < j->first) {
+      items.push_back(&*i++);
+    } else if (j->first < i->first) {
+      items.push_back(&*j++);
+    } else {
+      ++i;
+      ++j;
     }
-    ++it;
   }
-  return end();  // Возвращаем итератор на конец, если элемент не найден
+  for (; i != i_end; ++i) items.push_back(&*i);
+  for (; j != j_end; ++j) items.push_back(&*j);
+  return from_items(items);
+}
+
+// Сбалансированное дерево из уже упорядоченного списка элементов
+template <typename Key, typename A>
+Set<Key, A> Set<Key, A>::from_items(const ItemList& items) const {
+  Set result(get_allocator());
+  result.map_.assign_sorted(ItemIterator<Item>(items.data()),
+                            ItemIterator<Item>(items.data() + items.size()));
+  return result;
+}
+
+// Извлечение узла из множества
+template <typename Key, typename A>
+typename Set<Key, A>::node_type Set<Key, A>::extract(iterator pos) {
+  return map_.extract(pos);
+}
+
+template <typename Key, typename A>
+typename Set<Key, A>::node_type Set<Key, A>::extract(const key_type& key) {
+  return map_.extract(key);
+}
+
+// Вставка ранее извлеченного узла
+template <typename Key, typename A>
+typename Set<Key, A>::insert_return_type Set<Key, A>::insert(node_type&& node) {
+  return map_.insert(std::move(node));
+}
+
+// Поиск элемента по ключу спуском по дереву
+template <typename Key, typename A>
+typename Set<Key, A>::iterator Set<Key, A>::find(const Key& key) {
+  return map_.find(key);
 }
 
-// // Проверка на наличие элемента
 // Проверка на наличие элемента по ключу
-template <typename Key>
-bool Set<Key>::contains(const Key& key) {
-  return find(key) != end();
+template <typename Key, typename A>
+bool Set<Key, A>::contains(const Key& key) {
+  return map_.contains(key);
 }
 
 // Итератор на начало множества
-template <typename Key>
-typename Set<Key>::iterator Set<Key>::begin() noexcept {
+template <typename Key, typename A>
+typename Set<Key, A>::iterator Set<Key, A>::begin() noexcept {
   return map_.begin();
 }
 
 // Итератор на конец множества
-template <typename Key>
-typename Set<Key>::iterator Set<Key>::end() noexcept {
+template <typename Key, typename A>
+typename Set<Key, A>::iterator Set<Key, A>::end() noexcept {
   return map_.end();
 }
 
@@ -136,5 +361,8 @@ typename Set<Key>::iterator Set<Key>::end() noexcept {
 template class Set<int>;
 template class Set<double>;
 template class Set<std::string>;
+template class Set<int, std::pmr::polymorphic_allocator<int>>;
+template class Set<double, std::pmr::polymorphic_allocator<double>>;
+template class Set<std::string, std::pmr::polymorphic_allocator<std::string>>;
 
 }  // namespace s21
@@ -2,27 +2,41 @@
 #define S21_SET_H_
 
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 
 #include "s21_map.h"
+#include "s21_vector.h"
 
 namespace s21 {
 
-template <typename Key>
+// Allocator приводится к типу пары узла Map; правила те же, что у s21::Map
+template <typename Key, typename Allocator = std::allocator<Key>>
 class Set {
+ private:
+  using Tree = Map<Key, Key,
+                   typename std::allocator_traits<Allocator>::template
+                   rebind_alloc<std::pair<const Key, Key>>>;
+
  public:
   // Типы
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename Map<Key, Key>::iterator;
-  using const_iterator = typename Map<Key, Key>::const_iterator;
+  using iterator = typename Tree::iterator;
+  using const_iterator = typename Tree::const_iterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using node_type = typename Tree::node_type;
+  using insert_return_type = typename Tree::insert_return_type;
 
   // Конструкторы
   Set();
-  Set(std::initializer_list<value_type> const& items);
+  explicit Set(const allocator_type& alloc);
+  Set(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc = allocator_type());
   Set(const Set& other);
   Set(Set&& other) noexcept;
   ~Set();
@@ -30,7 +44,9 @@ class Set {
   // Операторы
   Set& operator=(
       const Set& other);  // Определение оператора присваивания копированием
-  Set& operator=(Set&& other) noexcept;
+  Set& operator=(Set&& other);  // может выделять память при разных аллокаторах
+
+  allocator_type get_allocator() const;
 
   // Итераторы
   iterator begin() noexcept;
@@ -44,18 +60,54 @@ class Set {
   // Модификаторы
   void clear() noexcept;
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  // Ключ нужен до спуска по дереву, поэтому создается заранее
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
   void erase(iterator pos);
   void swap(Set& other) noexcept;
   void merge(Set& other);
+  node_type extract(iterator pos);
+  node_type extract(const key_type& key);
+  insert_return_type insert(node_type&& node);
+
+  // Операции над множествами: оба множества обходятся по порядку за один
+  // линейный проход, результат строится сразу сбалансированным деревом
+  // без вставок по одному элементу. Пересечение и разность при сильно
+  // различающихся размерах ищут элементы меньшего множества в большем
+  // спуском по дереву - O(m log n) вместо O(m + n)
+  Set set_union(const Set& other) const;
+  Set set_intersection(const Set& other) const;
+  Set set_difference(const Set& other) const;
+  Set set_symmetric_difference(const Set& other) const;
 
   // Поиск
   iterator find(const key_type& key);
   bool contains(const key_type& key);
 
  private:
-  Map<key_type, value_type> map_;
+  using Item = typename Tree::value_type;
+  using ItemList = s21::Vector<const Item*>;
+
+  // Во сколько раз одно множество должно быть больше другого, чтобы
+  // поиск в дереве обогнал линейный проход по обоим
+  static constexpr size_type kLookupRatio = 16;
+
+  static bool lookup_is_cheaper(size_type small, size_type large) {
+    return small <= large / kLookupRatio;
+  }
+  Set from_items(const ItemList& items) const;
+
+  Tree map_;
 };
 
+namespace pmr {
+template <typename Key>
+using Set = s21::Set<Key, std::pmr::polymorphic_allocator<Key>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // S21_SET_H_
@@ -0,0 +1,563 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Vector with room for N elements inside the object itself: the heap is
+// touched only once the size exceeds N, so short-lived scratch arrays that
+// stay small never allocate. The interface and the iterator type (T*)
+// match s21::Vector. Moving a SmallVector whose elements are still inline
+// moves them one by one, so it is O(size) rather than a pointer swap.
+// Allocator rules are those of s21::Vector.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class SmallVector {
+  static_assert(N > 0, "use s21::Vector for a vector without inline storage");
+
+ public:
+  // Member types
+  using allocator_type = Allocator;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+  static constexpr size_type inline_capacity = N;
+
+  // Constructors
+  SmallVector();
+  explicit SmallVector(const allocator_type& alloc);
+  explicit SmallVector(size_type n,
+                       const allocator_type& alloc = allocator_type());
+  SmallVector(std::initializer_list<value_type> const& items,
+              const allocator_type& alloc = allocator_type());
+  SmallVector(const SmallVector& v);
+  SmallVector(const SmallVector& v, const allocator_type& alloc);
+  SmallVector(SmallVector&& v);
+  SmallVector(SmallVector&& v, const allocator_type& alloc);
+  ~SmallVector();
+
+  // Operator=
+  SmallVector& operator=(const SmallVector& v);
+  SmallVector& operator=(SmallVector&& v);
+
+  // Element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front() const;
+  const_reference back() const;
+  T* data();
+  const T* data() const;
+  allocator_type get_allocator() const;
+
+  // Iterators
+  iterator begin();
+  const_iterator begin() const;
+  iterator end();
+  const_iterator end() const;
+
+  // Capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+  void shrink_to_fit();
+  // True while the elements live in the inline buffer
+  bool is_inline() const;
+
+  // Modifiers
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(SmallVector& other);
+
+ private:
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<T>::value;
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  [[no_unique_address]] Allocator alloc_;
+  T* data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(T) unsigned char inline_[N * sizeof(T)];
+
+  T* inline_data();
+  // Destroys the elements and frees a heap buffer; the vector is left
+  // without storage and has to be reset before further use.
+  void release();
+  void reset_to_inline();
+  // Moves the elements of v into this empty inline vector, growing it if
+  // they do not fit, and leaves v empty.
+  void take_elements(SmallVector& v);
+
+  T* allocate(size_type n);
+  void deallocate(T* ptr, size_type n);
+  template <typename... Args>
+  void construct(T* ptr, Args&&... args);
+  void destroy(T* first, T* last);
+  template <typename InputIt>
+  void construct_range(InputIt first, InputIt last, T* dest);
+  void relocate(T* first, T* last, T* dest);
+
+  void reallocate(size_type new_capacity);
+  size_type grown_capacity() const;
+};
+
+// Implementations
+
+// Constructors
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector()
+    : alloc_(), data_(inline_data()), size_(0), capacity_(N) {}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const allocator_type& alloc)
+    : alloc_(alloc), data_(inline_data()), size_(0), capacity_(N) {}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(size_type n, const allocator_type& alloc)
+    : SmallVector(alloc) {
+  try {
+    reserve(n);
+    for (; size_ < n; ++size_) construct(data_ + size_);
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(
+    std::initializer_list<value_type> const& items,
+    const allocator_type& alloc)
+    : SmallVector(alloc) {
+  try {
+    reserve(items.size());
+    construct_range(items.begin(), items.end(), data_);
+  } catch (...) {
+    release();
+    throw;
+  }
+  size_ = items.size();
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const SmallVector& v)
+    : SmallVector(
+          v, AllocTraits::select_on_container_copy_construction(v.alloc_)) {}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(const SmallVector& v,
+                                  const allocator_type& alloc)
+    : SmallVector(alloc) {
+  try {
+    reserve(v.size_);
+    construct_range(v.data_, v.data_ + v.size_, data_);
+  } catch (...) {
+    release();
+    throw;
+  }
+  size_ = v.size_;
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(SmallVector&& v)
+    : alloc_(v.alloc_), data_(inline_data()), size_(0), capacity_(N) {
+  take_elements(v);
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::SmallVector(SmallVector&& v, const allocator_type& alloc)
+    : SmallVector(alloc) {
+  take_elements(v);
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>::~SmallVector() {
+  release();
+}
+
+// Operator=
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(const SmallVector& v) {
+  if (this != &v) {
+    SmallVector copy(v, alloc_);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename A>
+SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(SmallVector&& v) {
+  if (this != &v) {
+    release();
+    reset_to_inline();
+    take_elements(v);
+  }
+  return *this;
+}
+
+// Element access
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::reference SmallVector<T, N, A>::at(
+    size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("SmallVector::at: index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::reference SmallVector<T, N, A>::operator[](
+    size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::const_reference
+SmallVector<T, N, A>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::const_reference SmallVector<T, N, A>::front()
+    const {
+  return data_[0];
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::const_reference SmallVector<T, N, A>::back()
+    const {
+  return data_[size_ - 1];
+}
+
+template <typename T, std::size_t N, typename A>
+T* SmallVector<T, N, A>::data() {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename A>
+const T* SmallVector<T, N, A>::data() const {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::allocator_type
+SmallVector<T, N, A>::get_allocator() const {
+  return alloc_;
+}
+
+// Iterators
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::begin() {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::const_iterator SmallVector<T, N, A>::begin()
+    const {
+  return data_;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::end() {
+  return data_ + size_;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::const_iterator SmallVector<T, N, A>::end()
+    const {
+  return data_ + size_;
+}
+
+// Capacity
+template <typename T, std::size_t N, typename A>
+bool SmallVector<T, N, A>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::size() const {
+  return size_;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::reserve(size_type new_capacity) {
+  if (new_capacity > capacity_) {
+    reallocate(new_capacity);
+  }
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::capacity()
+    const {
+  return capacity_;
+}
+
+// Elements that fit again go back to the inline buffer
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::shrink_to_fit() {
+  if (size_ < capacity_ && capacity_ > N) {
+    reallocate(std::max(size_, N));
+  }
+}
+
+template <typename T, std::size_t N, typename A>
+bool SmallVector<T, N, A>::is_inline() const {
+  return capacity_ == N;
+}
+
+// Modifiers
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::clear() {
+  destroy(data_, data_ + size_);
+  size_ = 0;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::insert(
+    iterator pos, const_reference value) {
+  size_type index = pos - begin();
+  if (index == size_ && size_ < capacity_) {
+    construct(data_ + size_, value);
+    ++size_;
+  } else {
+    // Copied first: value may refer to an element that is about to move
+    T copy(value);
+    if (size_ >= capacity_) {
+      reallocate(grown_capacity());
+    }
+    if (index == size_) {
+      construct(data_ + size_, std::move(copy));
+      ++size_;
+    } else {
+      if constexpr (kTriviallyRelocatable) {
+        std::memmove(static_cast<void*>(data_ + index + 1), data_ + index,
+                     (size_ - index) * sizeof(T));
+        ++size_;
+      } else {
+        construct(data_ + size_, std::move(data_[size_ - 1]));
+        // Counted before the shift, as in Vector::emplace
+        ++size_;
+        std::move_backward(data_ + index, data_ + size_ - 2,
+                           data_ + size_ - 1);
+      }
+      data_[index] = std::move(copy);
+    }
+  }
+  return begin() + index;
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::erase(iterator pos) {
+  if (pos >= begin() && pos < end()) {
+    if constexpr (kTriviallyRelocatable) {
+      std::memmove(static_cast<void*>(pos), pos + 1,
+                   (end() - pos - 1) * sizeof(T));
+    } else {
+      std::move(pos + 1, end(), pos);
+      AllocTraits::destroy(alloc_, data_ + size_ - 1);
+    }
+    --size_;
+  }
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::push_back(const_reference value) {
+  if (size_ >= capacity_) {
+    insert(end(), value);
+  } else {
+    construct(data_ + size_, value);
+    ++size_;
+  }
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::pop_back() {
+  if (size_ > 0) {
+    AllocTraits::destroy(alloc_, data_ + size_ - 1);
+    --size_;
+  }
+}
+
+// Two heap buffers trade pointers, together with the allocators when
+// those propagate on swap. Otherwise the elements are moved through a
+// temporary and every buffer stays with the allocator that owns it.
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::swap(SmallVector& other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  } else {
+    SmallVector temp(std::move(other));
+    other.take_elements(*this);
+    take_elements(temp);
+  }
+}
+
+// Private member functions
+template <typename T, std::size_t N, typename A>
+T* SmallVector<T, N, A>::inline_data() {
+  return reinterpret_cast<T*>(inline_);
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::release() {
+  destroy(data_, data_ + size_);
+  if (!is_inline()) deallocate(data_, capacity_);
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::reset_to_inline() {
+  data_ = inline_data();
+  size_ = 0;
+  capacity_ = N;
+}
+
+// A heap buffer changes hands when the allocators agree, inline elements
+// are always moved.
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::take_elements(SmallVector& v) {
+  if (!v.is_inline() && alloc_ == v.alloc_) {
+    data_ = v.data_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+  } else {
+    reserve(v.size_);
+    try {
+      relocate(v.data_, v.data_ + v.size_, data_);
+    } catch (...) {
+      if (!is_inline()) deallocate(data_, capacity_);
+      reset_to_inline();
+      throw;
+    }
+    size_ = v.size_;
+    if (!v.is_inline()) v.deallocate(v.data_, v.capacity_);
+  }
+  v.reset_to_inline();
+}
+
+template <typename T, std::size_t N, typename A>
+T* SmallVector<T, N, A>::allocate(size_type n) {
+  return AllocTraits::allocate(alloc_, n);
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::deallocate(T* ptr, size_type n) {
+  AllocTraits::deallocate(alloc_, ptr, n);
+}
+
+template <typename T, std::size_t N, typename A>
+template <typename... Args>
+void SmallVector<T, N, A>::construct(T* ptr, Args&&... args) {
+  AllocTraits::construct(alloc_, ptr, std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::destroy(T* first, T* last) {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (; first != last; ++first) AllocTraits::destroy(alloc_, first);
+  }
+}
+
+// Constructs copies of [first, last) in uninitialized dest. On an
+// exception the copies made so far are destroyed.
+template <typename T, std::size_t N, typename A>
+template <typename InputIt>
+void SmallVector<T, N, A>::construct_range(InputIt first, InputIt last,
+                                           T* dest) {
+  if constexpr (kTriviallyRelocatable && std::is_pointer<InputIt>::value) {
+    std::uninitialized_copy(first, last, dest);
+  } else {
+    T* current = dest;
+    try {
+      for (; first != last; ++first, ++current) construct(current, *first);
+    } catch (...) {
+      destroy(dest, current);
+      throw;
+    }
+  }
+}
+
+// Moves [first, last) into uninitialized dest and ends the lifetime of the
+// source objects. Trivially copyable types are copied as one block.
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::relocate(T* first, T* last, T* dest) {
+  if constexpr (kTriviallyRelocatable) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+    }
+  } else {
+    T* current = dest;
+    try {
+      for (T* it = first; it != last; ++it, ++current) {
+        construct(current, std::move_if_noexcept(*it));
+      }
+    } catch (...) {
+      destroy(dest, current);
+      throw;
+    }
+    destroy(first, last);
+  }
+}
+
+// new_capacity == N moves the elements back into the inline buffer
+template <typename T, std::size_t N, typename A>
+void SmallVector<T, N, A>::reallocate(size_type new_capacity) {
+  T* new_data = new_capacity == N ? inline_data() : allocate(new_capacity);
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    if (new_data != inline_data()) deallocate(new_data, new_capacity);
+    throw;
+  }
+  if (!is_inline()) deallocate(data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+template <typename T, std::size_t N, typename A>
+typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::grown_capacity()
+    const {
+  return 2 * capacity_;
+}
+
+namespace pmr {
+template <typename T, std::size_t N>
+using SmallVector =
+    s21::SmallVector<T, N, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H
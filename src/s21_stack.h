@@ -1,18 +1,31 @@
 #ifndef Containers_Stack_H
 #define Containers_Stack_H
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 #include "s21_list.h"
+#include "s21_vector.h"
 
 namespace s21 {
 
-template <class T>
+// Container must provide push_back, emplace_back, pop_back, back, size,
+// empty and swap; s21::Vector, s21::List and s21::Deque all qualify.
+template <class T, class Container = s21::Vector<T>>
 class Stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
 
   Stack();
+  // Passes alloc (e.g. a std::pmr::memory_resource*) to the container
+  template <class Alloc, class = std::enable_if_t<
+                             std::uses_allocator<Container, Alloc>::value>>
+  explicit Stack(const Alloc& alloc) : container_(alloc) {}
   Stack(std::initializer_list<value_type> const& items);
   Stack(const Stack& s);
   Stack(Stack&& s);
@@ -24,73 +37,99 @@ class Stack {
   inline bool empty() const noexcept;
   inline size_type size() const noexcept;
 
-  inline void push(const_reference value) noexcept;
-  inline void pop() noexcept;
+  inline void push(const_reference value);
+  inline void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  // Pushes every argument in order
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+  inline void pop();
   inline void swap(Stack& other) noexcept;
 
  private:
-  s21::List<T> container_;
+  Container container_;
 };
 
-template <class T>
-Stack<T>::Stack() {}
+template <class T, class Container>
+Stack<T, Container>::Stack() {}
 
-template <class T>
-Stack<T>::~Stack() {}
+template <class T, class Container>
+Stack<T, Container>::~Stack() {}
 
-template <class T>
-Stack<T>::Stack(std::initializer_list<value_type> const& items) {
-  container_.assign(items);
+template <class T, class Container>
+Stack<T, Container>::Stack(std::initializer_list<value_type> const& items) {
+  for (const auto& item : items) container_.push_back(item);
 }
 
-template <class T>
-Stack<T>::Stack(const Stack& s) {
-  s21::List<T> buf(s.container_);
-  container_.swap(buf);
-}
+template <class T, class Container>
+Stack<T, Container>::Stack(const Stack& s) : container_(s.container_) {}
 
-template <class T>
-Stack<T>::Stack(Stack&& s) {
-  container_.swap(s.container_);
-}
+template <class T, class Container>
+Stack<T, Container>::Stack(Stack&& s) : container_(std::move(s.container_)) {}
 
-template <class T>
-Stack<T>& Stack<T>::operator=(Stack&& s) {
+template <class T, class Container>
+Stack<T, Container>& Stack<T, Container>::operator=(Stack&& s) {
   if (&s != this) {
-    container_.clear();
-    container_.swap(s.container_);
+    container_ = std::move(s.container_);
   }
   return *this;
 }
 
-template <class T>
-inline typename Stack<T>::const_reference Stack<T>::top() const {
+template <class T, class Container>
+inline typename Stack<T, Container>::const_reference
+Stack<T, Container>::top() const {
+  if (empty()) throw std::runtime_error("top called on empty stack");
   return container_.back();
 }
-template <class T>
-inline bool Stack<T>::empty() const noexcept {
+template <class T, class Container>
+inline bool Stack<T, Container>::empty() const noexcept {
   return container_.empty();
 }
 
-template <class T>
-inline typename Stack<T>::size_type Stack<T>::size() const noexcept {
+template <class T, class Container>
+inline typename Stack<T, Container>::size_type Stack<T, Container>::size()
+    const noexcept {
   return container_.size();
 }
 
-template <class T>
-inline void Stack<T>::push(const_reference value) noexcept {
+template <class T, class Container>
+inline void Stack<T, Container>::push(const_reference value) {
   container_.push_back(value);
 }
 
-template <class T>
-inline void Stack<T>::pop() noexcept {
+template <class T, class Container>
+inline void Stack<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+}
+
+template <class T, class Container>
+template <class... Args>
+void Stack<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T, class Container>
+template <class... Args>
+void Stack<T, Container>::insert_many_back(Args&&... args) {
+  (container_.emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class T, class Container>
+inline void Stack<T, Container>::pop() {
+  if (empty()) throw std::runtime_error("pop called on empty stack");
   container_.pop_back();
 }
 
-template <class T>
-inline void Stack<T>::swap(Stack& other) noexcept {
+template <class T, class Container>
+inline void Stack<T, Container>::swap(Stack& other) noexcept {
   container_.swap(other.container_);
 }
+namespace pmr {
+template <class T>
+using Stack = s21::Stack<T, pmr::Vector<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // !Containers_Stack_H
\ No newline at end of file
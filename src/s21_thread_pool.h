@@ -0,0 +1,323 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_deque.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+
+// Fixed-size pool of worker threads for fork-join work. Every worker owns a
+// WorkStealingDeque: tasks a worker spawns go to the bottom of its own deque
+// and it runs them newest first, which keeps the data they touch in its
+// cache. An idle worker takes tasks submitted from outside the pool (a
+// mutex-guarded s21::Deque), then steals the oldest task of a randomly
+// chosen victim - usually the largest piece of a split range. Workers that
+// find nothing sleep on a condition variable until a task arrives.
+//
+// Tasks posted with post() must not throw; submit() and TaskGroup::run()
+// carry exceptions back to the waiting thread. The destructor runs every
+// task already submitted and then joins the workers.
+class ThreadPool {
+ public:
+  using size_type = std::size_t;
+
+  explicit ThreadPool(size_type threads = default_threads());
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  // Runs f() on the pool; its result or exception arrives in the future
+  template <class F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f);
+  // Runs f() on the pool without a way to wait for it
+  template <class F>
+  void post(F&& f);
+
+  // Runs one pending task on the calling thread if there is one. A thread
+  // waiting for results calls this instead of blocking a worker.
+  bool run_pending_task();
+
+  size_type size() const noexcept { return size_; }
+  // Index of the calling worker, or size() when called from another thread
+  size_type current_worker() const noexcept;
+
+  static size_type default_threads() noexcept {
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+  }
+
+ private:
+  struct Task {
+    virtual ~Task() = default;
+    virtual void run() noexcept = 0;
+  };
+
+  template <class F>
+  struct FunctionTask : Task {
+    explicit FunctionTask(F&& function) : function(std::move(function)) {}
+    void run() noexcept override { function(); }
+    F function;
+  };
+
+  struct Worker {
+    WorkStealingDeque<Task*> tasks;
+    std::uint64_t random_state = 0;
+  };
+
+  void enqueue(Task* task);
+  Task* find_task(size_type self, std::uint64_t& random_state);
+  Task* steal_task(size_type self, std::uint64_t& random_state);
+  void worker_loop(size_type index);
+  void stop_and_join() noexcept;
+
+  static std::uint64_t next_random(std::uint64_t& state) noexcept;
+
+  // Which pool and worker the calling thread belongs to
+  struct CurrentThread {
+    const ThreadPool* pool = nullptr;
+    size_type index = 0;
+  };
+  static CurrentThread& current_thread() noexcept {
+    static thread_local CurrentThread current;
+    return current;
+  }
+
+  const size_type size_;
+  std::unique_ptr<Worker[]> workers_;
+  std::vector<std::thread> threads_;
+
+  std::mutex injection_mutex_;
+  s21::Deque<Task*> injection_;
+
+  // Tasks queued anywhere and not yet taken; counted before they become
+  // visible so a worker never sleeps while one is on its way
+  std::atomic<size_type> pending_{0};
+  std::atomic<size_type> sleepers_{0};
+  std::atomic<bool> stop_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+};
+
+// A set of tasks run on a pool and waited for together. wait() helps the
+// pool run tasks instead of blocking, so a task may create and wait for its
+// own group (recursive fork-join) without starving the pool. The first
+// exception thrown by a task is rethrown from wait().
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  // Waits for the remaining tasks; their exceptions are dropped
+  ~TaskGroup();
+
+  template <class F>
+  void run(F&& f);
+  void wait();
+
+ private:
+  ThreadPool& pool_;
+  std::atomic<std::size_t> outstanding_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+// ThreadPool
+
+inline ThreadPool::ThreadPool(size_type threads)
+    : size_(threads == 0 ? 1 : threads), workers_(new Worker[size_]) {
+  threads_.reserve(size_);
+  try {
+    for (size_type i = 0; i < size_; ++i) {
+      workers_[i].random_state = 0x9E3779B97F4A7C15ull * (i + 1);
+      threads_.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+  } catch (...) {
+    stop_and_join();
+    throw;
+  }
+}
+
+inline ThreadPool::~ThreadPool() { stop_and_join(); }
+
+inline void ThreadPool::stop_and_join() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_.store(true);
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) thread.join();
+  threads_.clear();
+}
+
+template <class F>
+std::future<std::invoke_result_t<std::decay_t<F>>> ThreadPool::submit(F&& f) {
+  using Result = std::invoke_result_t<std::decay_t<F>>;
+  std::packaged_task<Result()> task(std::forward<F>(f));
+  std::future<Result> result = task.get_future();
+  post(std::move(task));
+  return result;
+}
+
+template <class F>
+void ThreadPool::post(F&& f) {
+  enqueue(new FunctionTask<std::decay_t<F>>(std::decay_t<F>(
+      std::forward<F>(f))));
+}
+
+inline void ThreadPool::enqueue(Task* task) {
+  pending_.fetch_add(1);
+  try {
+    const CurrentThread& current = current_thread();
+    if (current.pool == this) {
+      workers_[current.index].tasks.push(task);
+    } else {
+      std::lock_guard<std::mutex> lock(injection_mutex_);
+      injection_.push_back(task);
+    }
+  } catch (...) {
+    pending_.fetch_sub(1);
+    delete task;
+    throw;
+  }
+  // A sleeper registers itself before checking pending_, so either it sees
+  // the new task or we see it and wake it under the mutex
+  if (sleepers_.load() > 0) {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wake_.notify_one();
+  }
+}
+
+inline ThreadPool::size_type ThreadPool::current_worker() const noexcept {
+  const CurrentThread& current = current_thread();
+  return current.pool == this ? current.index : size_;
+}
+
+inline std::uint64_t ThreadPool::next_random(std::uint64_t& state) noexcept {
+  // xorshift64
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+inline ThreadPool::Task* ThreadPool::find_task(size_type self,
+                                               std::uint64_t& random_state) {
+  Task* task = nullptr;
+  if (self < size_ && workers_[self].tasks.pop(task)) {
+    pending_.fetch_sub(1);
+    return task;
+  }
+  {
+    std::lock_guard<std::mutex> lock(injection_mutex_);
+    if (!injection_.empty()) {
+      task = injection_.front();
+      injection_.pop_front();
+    }
+  }
+  if (task == nullptr) task = steal_task(self, random_state);
+  if (task != nullptr) pending_.fetch_sub(1);
+  return task;
+}
+
+inline ThreadPool::Task* ThreadPool::steal_task(size_type self,
+                                                std::uint64_t& random_state) {
+  const size_type start = next_random(random_state) % size_;
+  Task* task = nullptr;
+  for (size_type i = 0; i < size_; ++i) {
+    const size_type victim = (start + i) % size_;
+    if (victim != self && workers_[victim].tasks.steal(task)) return task;
+  }
+  return nullptr;
+}
+
+inline bool ThreadPool::run_pending_task() {
+  const size_type self = current_worker();
+  thread_local std::uint64_t outside_state =
+      0xD1B54A32D192ED03ull ^
+      std::hash<std::thread::id>()(std::this_thread::get_id());
+  Task* task =
+      find_task(self, self < size_ ? workers_[self].random_state
+                                   : outside_state);
+  if (task == nullptr) return false;
+  task->run();
+  delete task;
+  return true;
+}
+
+inline void ThreadPool::worker_loop(size_type index) {
+  current_thread() = CurrentThread{this, index};
+  Worker& self = workers_[index];
+  while (true) {
+    if (Task* task = find_task(index, self.random_state)) {
+      task->run();
+      delete task;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleepers_.fetch_add(1);
+    wake_.wait(lock, [this] { return pending_.load() > 0 || stop_.load(); });
+    sleepers_.fetch_sub(1);
+    if (stop_.load() && pending_.load() == 0) break;
+  }
+  current_thread() = CurrentThread{};
+}
+
+// TaskGroup
+
+inline TaskGroup::~TaskGroup() {
+  try {
+    wait();
+  } catch (...) {
+  }
+}
+
+template <class F>
+void TaskGroup::run(F&& f) {
+  using Function = std::decay_t<F>;
+  outstanding_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    pool_.post([this, function = Function(std::forward<F>(f))]() mutable {
+      try {
+        function();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+      // Last touch of the group: wait() may return and destroy it after
+      outstanding_.fetch_sub(1, std::memory_order_release);
+    });
+  } catch (...) {
+    outstanding_.fetch_sub(1, std::memory_order_relaxed);
+    throw;
+  }
+}
+
+inline void TaskGroup::wait() {
+  while (outstanding_.load(std::memory_order_acquire) != 0) {
+    if (!pool_.run_pending_task()) std::this_thread::yield();
+  }
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    error.swap(error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+}  // namespace s21
+
+#endif  // S21_THREAD_POOL_H
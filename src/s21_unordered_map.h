@@ -0,0 +1,293 @@
+#ifndef S21_UNORDERED_MAP_H_
+#define S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Хеш-таблица с открытой адресацией (см. s21_hash_table.h) с интерфейсом
+// s21::Map; порядок обхода не определен
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedMap {
+ private:
+  // Извлечение ключа из хранимой пары
+  struct KeyOfPair {
+    const Key& operator()(const std::pair<const Key, T>& value) const {
+      return value.first;
+    }
+  };
+  using Table =
+      HashTable<std::pair<const Key, T>, Key, KeyOfPair, Hash, KeyEqual>;
+
+ public:
+  // Типы, определенные внутри класса
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = typename Table::iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  // Конструкторы и деструктор
+  UnorderedMap();
+  UnorderedMap(std::initializer_list<value_type> const& items);
+  UnorderedMap(const UnorderedMap& m);
+  UnorderedMap(UnorderedMap&& m);
+  ~UnorderedMap();
+
+  UnorderedMap& operator=(const UnorderedMap& m);
+  UnorderedMap& operator=(UnorderedMap&& m);
+
+  // Доступ к элементам
+  T& at(const Key& key);
+  const T& at(const Key& key) const;
+  T& operator[](const Key& key);
+
+  // Итераторы
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // Вместимость
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type bucket_count() const;
+  void reserve(size_type count);
+
+  // Модификаторы
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  void erase(iterator pos);
+  size_type erase(const Key& key);
+  void swap(UnorderedMap& other);
+  void merge(UnorderedMap& other);
+
+  // Поиск
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+
+ private:
+  Table table_;
+};
+
+// Конструкторы и деструктор
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap() : table_() {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(
+    std::initializer_list<value_type> const& items) {
+  table_.reserve(items.size());
+  for (const auto& item : items) {
+    insert(item);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(const UnorderedMap& m)
+    : table_(m.table_) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::UnorderedMap(UnorderedMap&& m)
+    : table_(std::move(m.table_)) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>::~UnorderedMap() {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>&
+UnorderedMap<Key, T, Hash, KeyEqual>::operator=(const UnorderedMap& m) {
+  table_ = m.table_;
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+UnorderedMap<Key, T, Hash, KeyEqual>&
+UnorderedMap<Key, T, Hash, KeyEqual>::operator=(UnorderedMap&& m) {
+  table_ = std::move(m.table_);
+  return *this;
+}
+
+// Доступ к элементам
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T& UnorderedMap<Key, T, Hash, KeyEqual>::at(const Key& key) {
+  auto it = table_.find(key);
+  if (it == table_.end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+const T& UnorderedMap<Key, T, Hash, KeyEqual>::at(const Key& key) const {
+  auto it = table_.find(key);
+  if (it == table_.end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it->second;
+}
+
+// Значение T() создается только при отсутствии ключа
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T& UnorderedMap<Key, T, Hash, KeyEqual>::operator[](const Key& key) {
+  return table_
+      .emplace_unique(key, std::piecewise_construct,
+                      std::forward_as_tuple(key), std::forward_as_tuple())
+      .first->second;
+}
+
+// Итераторы
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::begin() {
+  return table_.begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::end() {
+  return table_.end();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::const_iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::begin() const {
+  return table_.begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::const_iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::end() const {
+  return table_.end();
+}
+
+// Вместимость
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool UnorderedMap<Key, T, Hash, KeyEqual>::empty() const {
+  return table_.empty();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::size_type
+UnorderedMap<Key, T, Hash, KeyEqual>::size() const {
+  return table_.size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::size_type
+UnorderedMap<Key, T, Hash, KeyEqual>::max_size() const {
+  return table_.max_size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::size_type
+UnorderedMap<Key, T, Hash, KeyEqual>::bucket_count() const {
+  return table_.bucket_count();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+// Модификаторы
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::clear() {
+  table_.clear();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert(const value_type& value) {
+  return table_.emplace_unique(value.first, value);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert(const Key& key, const T& obj) {
+  return table_.emplace_unique(key, key, obj);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator, bool>
+UnorderedMap<Key, T, Hash, KeyEqual>::insert_or_assign(const Key& key,
+                                                       const T& obj) {
+  auto result = table_.emplace_unique(key, key, obj);
+  if (!result.second) {
+    result.first->second = obj;
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase(pos);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::size_type
+UnorderedMap<Key, T, Hash, KeyEqual>::erase(const Key& key) {
+  return table_.erase(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::swap(UnorderedMap& other) {
+  table_.swap(other.table_);
+}
+
+// Переносит элементы, которых нет в текущем контейнере; совпадающие по
+// ключу остаются в other, как у std::unordered_map::merge
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void UnorderedMap<Key, T, Hash, KeyEqual>::merge(UnorderedMap& other) {
+  if (this == &other) return;
+  for (auto it = other.begin(); it != other.end();) {
+    auto current = it++;
+    if (table_.emplace_unique(current->first, std::move(*current)).second) {
+      other.table_.erase(current);
+    }
+  }
+}
+
+// Поиск
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::find(const Key& key) {
+  return table_.find(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename UnorderedMap<Key, T, Hash, KeyEqual>::const_iterator
+UnorderedMap<Key, T, Hash, KeyEqual>::find(const Key& key) const {
+  return table_.find(key);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool UnorderedMap<Key, T, Hash, KeyEqual>::contains(const Key& key) const {
+  return table_.contains(key);
+}
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MAP_H_
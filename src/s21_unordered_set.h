@@ -0,0 +1,93 @@
+#ifndef S21_UNORDERED_SET_H_
+#define S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Хеш-множество поверх той же таблицы, что и s21::UnorderedMap; интерфейс
+// повторяет s21::Set, порядок обхода не определен
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class UnorderedSet {
+ private:
+  // Ключом является само значение
+  struct Identity {
+    const Key& operator()(const Key& value) const { return value; }
+  };
+  using Table = HashTable<Key, Key, Identity, Hash, KeyEqual>;
+
+ public:
+  // Типы
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  // Элементы множества менять нельзя, поэтому оба итератора константные
+  using iterator = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  // Конструкторы
+  UnorderedSet() = default;
+  UnorderedSet(std::initializer_list<value_type> const& items) {
+    table_.reserve(items.size());
+    for (const auto& item : items) {
+      insert(item);
+    }
+  }
+  UnorderedSet(const UnorderedSet& other) = default;
+  UnorderedSet(UnorderedSet&& other) noexcept = default;
+  ~UnorderedSet() = default;
+
+  // Операторы
+  UnorderedSet& operator=(const UnorderedSet& other) = default;
+  UnorderedSet& operator=(UnorderedSet&& other) noexcept = default;
+
+  // Итераторы
+  iterator begin() const { return table_.begin(); }
+  iterator end() const { return table_.end(); }
+
+  // Вместимость
+  bool empty() const { return table_.empty(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+  size_type bucket_count() const { return table_.bucket_count(); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  // Модификаторы
+  void clear() { table_.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.emplace_unique(value, value);
+  }
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const key_type& key) { return table_.erase(key); }
+  void swap(UnorderedSet& other) noexcept { table_.swap(other.table_); }
+  // Элементы, уже присутствующие в текущем множестве, остаются в other
+  void merge(UnorderedSet& other) {
+    if (this == &other) return;
+    for (auto it = other.table_.begin(); it != other.table_.end();) {
+      auto current = it++;
+      if (table_.emplace_unique(*current, std::move(*current)).second) {
+        other.table_.erase(current);
+      }
+    }
+  }
+
+  // Поиск
+  iterator find(const key_type& key) const { return table_.find(key); }
+  bool contains(const key_type& key) const { return table_.contains(key); }
+
+ private:
+  Table table_;
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H_
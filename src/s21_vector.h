@@ -3,16 +3,79 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
 
 namespace s21 {
 
+namespace vector_detail {
+
+// Enables the iterator-range overloads only for iterators, so that
+// insert(pos, 3, 7) picks the count overload
+template <typename It>
+using RequireInputIterator = std::enable_if_t<std::is_convertible<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>::value>;
+
+// Forward iterator over count copies of one value: insert(pos, count,
+// value) goes through the same path as a range insert
 template <typename T>
+class RepeatIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+
+  RepeatIterator(const T* value, std::size_t index)
+      : value_(value), index_(index) {}
+
+  reference operator*() const { return *value_; }
+  pointer operator->() const { return value_; }
+  RepeatIterator& operator++() {
+    ++index_;
+    return *this;
+  }
+  RepeatIterator operator++(int) {
+    RepeatIterator old = *this;
+    ++index_;
+    return old;
+  }
+  bool operator==(const RepeatIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const RepeatIterator& other) const {
+    return index_ != other.index_;
+  }
+
+ private:
+  const T* value_;
+  std::size_t index_;
+};
+
+}  // namespace vector_detail
+
+// Allocator provides the buffer and constructs the elements. It stays with
+// the container on copy and move assignment; swap() exchanges allocators
+// only when they propagate on swap, otherwise they must compare equal.
+// Growth picks the capacity a full vector grows to (s21_growth_policy.h).
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Growth = GrowDouble>
 class Vector {
  public:
   // Member types
+  using allocator_type = Allocator;
+  using growth_policy = Growth;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
@@ -22,10 +85,14 @@ class Vector {
 
   // Constructors
   Vector();
-  explicit Vector(size_type n);
-  Vector(std::initializer_list<value_type> const& items);
+  explicit Vector(const allocator_type& alloc);
+  explicit Vector(size_type n, const allocator_type& alloc = allocator_type());
+  Vector(std::initializer_list<value_type> const& items,
+         const allocator_type& alloc = allocator_type());
   Vector(const Vector& v);
+  Vector(const Vector& v, const allocator_type& alloc);
   Vector(Vector&& v);
+  Vector(Vector&& v, const allocator_type& alloc);
   ~Vector();
 
   // Operator=
@@ -40,6 +107,7 @@ class Vector {
   const_reference back() const;
   T* data();
   const T* data() const;
+  allocator_type get_allocator() const;
 
   // Iterators
   iterator begin();
@@ -58,70 +126,182 @@ class Vector {
   // Modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, T&& value);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  // Range and count inserts reallocate at most once and move the tail
+  // at most once. The range must not point into this vector.
+  template <typename InputIt,
+            typename = vector_detail::RequireInputIterator<InputIt>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  iterator insert(iterator pos, size_type count, const_reference value);
+  template <typename Range>
+  void append_range(const Range& range);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void push_back(const_reference value);
+  void push_back(T&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void swap(Vector& other);
 
+  // Each argument constructs one element in place; insert_many returns
+  // the first of them
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
  private:
+  // Elements that can be relocated with memcpy/memmove instead of
+  // constructor calls.
+  static constexpr bool kTriviallyRelocatable =
+      std::is_trivially_copyable<T>::value;
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  [[no_unique_address]] Allocator alloc_;
   T* data_;
   size_type size_;
   size_type capacity_;
 
+  // Storage is raw memory: only [0, size_) holds constructed objects.
+  T* allocate(size_type n);
+  void deallocate(T* ptr, size_type n);
+  template <typename... Args>
+  void construct(T* ptr, Args&&... args);
+  void destroy(T* first, T* last);
+  template <typename InputIt>
+  void construct_range(InputIt first, InputIt last, T* dest);
+  void transfer(T* first, T* last, T* dest);
+  void relocate(T* first, T* last, T* dest);
+  template <typename ForwardIt>
+  void insert_forward(size_type index, ForwardIt first, ForwardIt last,
+                      size_type count);
+
   void reallocate(size_type new_capacity);
+  template <typename... Args>
+  void reallocate_append(Args&&... args);
+  size_type grown_capacity() const;
 };
 
 // Implementations
 
 // Constructors
-template <typename T>
-Vector<T>::Vector() : data_(nullptr), size_(0), capacity_(0) {}
-
-template <typename T>
-Vector<T>::Vector(size_type n) : data_(new T[n]()), size_(n), capacity_(n) {}
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector() : alloc_(), data_(nullptr), size_(0), capacity_(0) {}
+
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(const allocator_type& alloc)
+    : alloc_(alloc), data_(nullptr), size_(0), capacity_(0) {}
+
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(size_type n, const allocator_type& alloc)
+    : alloc_(alloc), data_(allocate(n)), size_(0), capacity_(n) {
+  try {
+    for (; size_ < n; ++size_) construct(data_ + size_);
+  } catch (...) {
+    destroy(data_, data_ + size_);
+    deallocate(data_, n);
+    throw;
+  }
+}
 
-template <typename T>
-Vector<T>::Vector(std::initializer_list<value_type> const& items)
-    : data_(new T[items.size()]), size_(items.size()), capacity_(items.size()) {
-  std::copy(items.begin(), items.end(), data_);
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(std::initializer_list<value_type> const& items,
+                        const allocator_type& alloc)
+    : alloc_(alloc),
+      data_(allocate(items.size())),
+      size_(items.size()),
+      capacity_(items.size()) {
+  try {
+    construct_range(items.begin(), items.end(), data_);
+  } catch (...) {
+    deallocate(data_, capacity_);
+    throw;
+  }
 }
 
-template <typename T>
-Vector<T>::Vector(const Vector& v)
-    : data_(new T[v.capacity_]), size_(v.size_), capacity_(v.capacity_) {
-  std::copy(v.data_, v.data_ + v.size_, data_);
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(const Vector& v)
+    : Vector(v,
+             AllocTraits::select_on_container_copy_construction(v.alloc_)) {}
+
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(const Vector& v, const allocator_type& alloc)
+    : alloc_(alloc),
+      data_(allocate(v.size_)),
+      size_(v.size_),
+      capacity_(v.size_) {
+  try {
+    construct_range(v.data_, v.data_ + v.size_, data_);
+  } catch (...) {
+    deallocate(data_, capacity_);
+    throw;
+  }
 }
 
-template <typename T>
-Vector<T>::Vector(Vector&& v)
-    : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(Vector&& v)
+    : alloc_(std::move(v.alloc_)),
+      data_(v.data_),
+      size_(v.size_),
+      capacity_(v.capacity_) {
   v.data_ = nullptr;
   v.size_ = 0;
   v.capacity_ = 0;
 }
 
-template <typename T>
-Vector<T>::~Vector() {
-  delete[] data_;
+// Takes over v's buffer when the allocators are equal; otherwise the
+// elements are moved one by one into storage from alloc.
+template <typename T, typename A, typename G>
+Vector<T, A, G>::Vector(Vector&& v, const allocator_type& alloc)
+    : alloc_(alloc), data_(nullptr), size_(0), capacity_(0) {
+  if (alloc_ == v.alloc_) {
+    std::swap(data_, v.data_);
+    std::swap(size_, v.size_);
+    std::swap(capacity_, v.capacity_);
+  } else {
+    data_ = allocate(v.size_);
+    capacity_ = v.size_;
+    try {
+      construct_range(std::make_move_iterator(v.data_),
+                      std::make_move_iterator(v.data_ + v.size_), data_);
+    } catch (...) {
+      deallocate(data_, capacity_);
+      throw;
+    }
+    size_ = v.size_;
+    v.clear();
+  }
+}
+
+template <typename T, typename A, typename G>
+Vector<T, A, G>::~Vector() {
+  destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
 }
 
 // Operator=
-template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector& v) {
+template <typename T, typename A, typename G>
+Vector<T, A, G>& Vector<T, A, G>::operator=(const Vector& v) {
   if (this != &v) {
-    delete[] data_;
-    data_ = new T[v.capacity_];
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    std::copy(v.data_, v.data_ + v.size_, data_);
+    Vector copy(v, alloc_);
+    swap(copy);
   }
   return *this;
 }
 
-template <typename T>
-Vector<T>& Vector<T>::operator=(Vector&& v) {
-  if (this != &v) {
-    delete[] data_;
+template <typename T, typename A, typename G>
+Vector<T, A, G>& Vector<T, A, G>::operator=(Vector&& v) {
+  if (this != &v && !(alloc_ == v.alloc_)) {
+    // The buffer cannot change hands, move the elements instead
+    Vector moved(std::move(v), alloc_);
+    swap(moved);
+  } else if (this != &v) {
+    destroy(data_, data_ + size_);
+    deallocate(data_, capacity_);
     data_ = v.data_;
     size_ = v.size_;
     capacity_ = v.capacity_;
@@ -133,165 +313,491 @@ Vector<T>& Vector<T>::operator=(Vector&& v) {
 }
 
 // Element access
-template <typename T>
-typename Vector<T>::reference Vector<T>::at(size_type pos) {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::reference Vector<T, A, G>::at(size_type pos) {
   if (pos >= size_) {
     throw std::out_of_range("Vector::at: index out of range");
   }
   return data_[pos];
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::operator[](size_type pos) {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::reference Vector<T, A, G>::operator[](size_type pos) {
   return data_[pos];
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::operator[](size_type pos) const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::const_reference Vector<T, A, G>::operator[](
+    size_type pos) const {
   return data_[pos];
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::front() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::const_reference Vector<T, A, G>::front() const {
   return data_[0];
 }
 
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::back() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::const_reference Vector<T, A, G>::back() const {
   return data_[size_ - 1];
 }
 
-template <typename T>
-T* Vector<T>::data() {
+template <typename T, typename A, typename G>
+T* Vector<T, A, G>::data() {
   return data_;
 }
 
-template <typename T>
-const T* Vector<T>::data() const {
+template <typename T, typename A, typename G>
+const T* Vector<T, A, G>::data() const {
   return data_;
 }
 
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::allocator_type Vector<T, A, G>::get_allocator()
+    const {
+  return alloc_;
+}
+
 // Iterators
-template <typename T>
-typename Vector<T>::iterator Vector<T>::begin() {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::begin() {
   return data_;
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::begin() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::const_iterator Vector<T, A, G>::begin() const {
   return data_;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::end() {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::end() {
   return data_ + size_;
 }
 
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::end() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::const_iterator Vector<T, A, G>::end() const {
   return data_ + size_;
 }
 
 // Capacity
-template <typename T>
-bool Vector<T>::empty() const {
+template <typename T, typename A, typename G>
+bool Vector<T, A, G>::empty() const {
   return size_ == 0;
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::size() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::size_type Vector<T, A, G>::size() const {
   return size_;
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::max_size() const {
-  return std::numeric_limits<size_type>::max();
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::size_type Vector<T, A, G>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
 }
 
-template <typename T>
-void Vector<T>::reserve(size_type new_capacity) {
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::reserve(size_type new_capacity) {
   if (new_capacity > capacity_) {
     reallocate(new_capacity);
   }
 }
 
-template <typename T>
-typename Vector<T>::size_type Vector<T>::capacity() const {
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::size_type Vector<T, A, G>::capacity() const {
   return capacity_;
 }
 
-template <typename T>
-void Vector<T>::shrink_to_fit() {
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::shrink_to_fit() {
   if (size_ < capacity_) {
     reallocate(size_);
   }
 }
 
 // Modifiers
-template <typename T>
-void Vector<T>::clear() {
-  for (size_type i = 0; i < size_; ++i) {
-    data_[i].~T();
-  }
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::clear() {
+  destroy(data_, data_ + size_);
   size_ = 0;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  size_type index = pos - begin();
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::insert(iterator pos,
+                                                           T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+// At the end the element is built in place. In the middle it is built
+// first, since args may refer to an element that is about to move, and
+// then moved into the gap.
+template <typename T, typename A, typename G>
+template <typename... Args>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::emplace(
+    const_iterator pos, Args&&... args) {
+  const size_type index = pos - begin();
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return begin() + index;
+  }
+  T value(std::forward<Args>(args)...);
   if (size_ >= capacity_) {
-    reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+    reallocate(grown_capacity());
   }
-  std::move_backward(begin() + index, end(), end() + 1);
-  data_[index] = value;
-  ++size_;
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(data_ + index + 1), data_ + index,
+                 (size_ - index) * sizeof(T));
+    ++size_;
+  } else {
+    construct(data_ + size_, std::move(data_[size_ - 1]));
+    // Counted before the shift, so the vector still owns the new last
+    // element if one of the moves throws
+    ++size_;
+    std::move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+  }
+  data_[index] = std::move(value);
   return begin() + index;
 }
 
-template <typename T>
-void Vector<T>::erase(iterator pos) {
+// Single-pass inputs are appended and rotated into place
+template <typename T, typename A, typename G>
+template <typename InputIt, typename>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::insert(iterator pos,
+                                                           InputIt first,
+                                                           InputIt last) {
+  const size_type index = pos - begin();
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+    insert_forward(index, first, last, std::distance(first, last));
+  } else {
+    const size_type old_size = size_;
+    for (; first != last; ++first) push_back(*first);
+    std::rotate(begin() + index, begin() + old_size, end());
+  }
+  return begin() + index;
+}
+
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::insert(
+    iterator pos, size_type count, const_reference value) {
+  const size_type index = pos - begin();
+  // Copied first: value may refer to an element that is about to move
+  const T copy(value);
+  insert_forward(index, vector_detail::RepeatIterator<T>(&copy, 0),
+                 vector_detail::RepeatIterator<T>(&copy, count), count);
+  return begin() + index;
+}
+
+template <typename T, typename A, typename G>
+template <typename Range>
+void Vector<T, A, G>::append_range(const Range& range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::erase(iterator pos) {
   if (pos >= begin() && pos < end()) {
-    pos->~T();
-    std::move(pos + 1, end(), pos);
+    if constexpr (kTriviallyRelocatable) {
+      std::memmove(static_cast<void*>(pos), pos + 1,
+                   (end() - pos - 1) * sizeof(T));
+    } else {
+      std::move(pos + 1, end(), pos);
+      AllocTraits::destroy(alloc_, data_ + size_ - 1);
+    }
     --size_;
   }
 }
 
-template <typename T>
-void Vector<T>::push_back(const_reference value) {
-  if (size_ >= capacity_) {
-    reallocate(capacity_ > 0 ? 2 * capacity_ : 1);
+// The tail after last moves once, then the leftover slots are destroyed
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::erase(iterator first,
+                                                          iterator last) {
+  if (first == last) return first;
+  const size_type count = last - first;
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(first), last, (end() - last) * sizeof(T));
+  } else {
+    std::move(last, end(), first);
+    destroy(end() - count, end());
   }
-  data_[size_] = value;
-  ++size_;
+  size_ -= count;
+  return first;
 }
 
-template <typename T>
-void Vector<T>::pop_back() {
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename A, typename G>
+template <typename... Args>
+typename Vector<T, A, G>::reference Vector<T, A, G>::emplace_back(
+    Args&&... args) {
+  if (size_ < capacity_) {
+    construct(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  } else {
+    reallocate_append(std::forward<Args>(args)...);
+  }
+  return data_[size_ - 1];
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::pop_back() {
   if (size_ > 0) {
-    data_[size_ - 1].~T();
+    AllocTraits::destroy(alloc_, data_ + size_ - 1);
     --size_;
   }
 }
 
-template <typename T>
-void Vector<T>::swap(Vector& other) {
+// Appended one by one, each built in place, then rotated into position:
+// the tail moves once however many arguments there are
+template <typename T, typename A, typename G>
+template <typename... Args>
+typename Vector<T, A, G>::iterator Vector<T, A, G>::insert_many(
+    const_iterator pos, Args&&... args) {
+  const size_type index = pos - begin();
+  const size_type old_size = size_;
+  (emplace_back(std::forward<Args>(args)), ...);
+  std::rotate(begin() + index, begin() + old_size, end());
+  return begin() + index;
+}
+
+template <typename T, typename A, typename G>
+template <typename... Args>
+void Vector<T, A, G>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::swap(Vector& other) {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
   std::swap(data_, other.data_);
   std::swap(size_, other.size_);
   std::swap(capacity_, other.capacity_);
 }
 
 // Private member functions
-template <typename T>
-void Vector<T>::reallocate(size_type new_capacity) {
-  T* new_data = new T[new_capacity];
-  std::move(data_, data_ + size_, new_data);
-  delete[] data_;
+template <typename T, typename A, typename G>
+T* Vector<T, A, G>::allocate(size_type n) {
+  return n > 0 ? AllocTraits::allocate(alloc_, n) : nullptr;
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::deallocate(T* ptr, size_type n) {
+  if (ptr) {
+    AllocTraits::deallocate(alloc_, ptr, n);
+  }
+}
+
+template <typename T, typename A, typename G>
+template <typename... Args>
+void Vector<T, A, G>::construct(T* ptr, Args&&... args) {
+  AllocTraits::construct(alloc_, ptr, std::forward<Args>(args)...);
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::destroy(T* first, T* last) {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (; first != last; ++first) AllocTraits::destroy(alloc_, first);
+  }
+}
+
+// Constructs copies of [first, last) in uninitialized dest. On an
+// exception the copies made so far are destroyed.
+template <typename T, typename A, typename G>
+template <typename InputIt>
+void Vector<T, A, G>::construct_range(InputIt first, InputIt last, T* dest) {
+  if constexpr (kTriviallyRelocatable && std::is_pointer<InputIt>::value) {
+    std::uninitialized_copy(first, last, dest);
+  } else {
+    T* current = dest;
+    try {
+      for (; first != last; ++first, ++current) construct(current, *first);
+    } catch (...) {
+      destroy(dest, current);
+      throw;
+    }
+  }
+}
+
+// Moves [first, last) into uninitialized dest, leaving the sources alive.
+// Trivially copyable types are copied as one block.
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::transfer(T* first, T* last, T* dest) {
+  if constexpr (kTriviallyRelocatable) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+    }
+  } else {
+    T* current = dest;
+    try {
+      for (T* it = first; it != last; ++it, ++current) {
+        construct(current, std::move_if_noexcept(*it));
+      }
+    } catch (...) {
+      destroy(dest, current);
+      throw;
+    }
+  }
+}
+
+// Moves [first, last) into uninitialized dest and ends the lifetime of the
+// source objects.
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::relocate(T* first, T* last, T* dest) {
+  transfer(first, last, dest);
+  destroy(first, last);
+}
+
+// Inserts count elements of [first, last) at index. Without room the new
+// elements are built in a fresh buffer first and the old ones transferred
+// around them, so a failure leaves the vector untouched. With room the
+// tail is shifted once: its last part into uninitialized storage, the rest
+// by assignment, as in std::vector.
+template <typename T, typename A, typename G>
+template <typename ForwardIt>
+void Vector<T, A, G>::insert_forward(size_type index, ForwardIt first,
+                                     ForwardIt last, size_type count) {
+  if (count == 0) return;
+  if (size_ + count > capacity_) {
+    const size_type new_capacity = std::max(grown_capacity(), size_ + count);
+    T* new_data = allocate(new_capacity);
+    try {
+      construct_range(first, last, new_data + index);
+    } catch (...) {
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    try {
+      transfer(data_, data_ + index, new_data);
+      try {
+        transfer(data_ + index, data_ + size_, new_data + index + count);
+      } catch (...) {
+        destroy(new_data, new_data + index);
+        throw;
+      }
+    } catch (...) {
+      destroy(new_data + index, new_data + index + count);
+      deallocate(new_data, new_capacity);
+      throw;
+    }
+    destroy(data_, data_ + size_);
+    deallocate(data_, capacity_);
+    data_ = new_data;
+    capacity_ = new_capacity;
+    size_ += count;
+    return;
+  }
+  T* pos = data_ + index;
+  T* old_end = data_ + size_;
+  const size_type tail = size_ - index;
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(pos + count), pos, tail * sizeof(T));
+    try {
+      construct_range(first, last, pos);
+    } catch (...) {
+      std::memmove(static_cast<void*>(pos), pos + count, tail * sizeof(T));
+      throw;
+    }
+    size_ += count;
+  } else if (count < tail) {
+    construct_range(std::make_move_iterator(old_end - count),
+                    std::make_move_iterator(old_end), old_end);
+    size_ += count;
+    std::move_backward(pos, old_end - count, old_end);
+    std::copy(first, last, pos);
+  } else {
+    // The new elements past the old end are constructed, the tail moves
+    // behind them and the rest of the range is assigned over the tail
+    ForwardIt middle = std::next(first, tail);
+    construct_range(middle, last, old_end);
+    T* moved_to = old_end + (count - tail);
+    try {
+      construct_range(std::make_move_iterator(pos),
+                      std::make_move_iterator(old_end), moved_to);
+    } catch (...) {
+      destroy(old_end, moved_to);
+      throw;
+    }
+    size_ += count;
+    std::copy(first, middle, pos);
+  }
+}
+
+template <typename T, typename A, typename G>
+void Vector<T, A, G>::reallocate(size_type new_capacity) {
+  T* new_data = allocate(new_capacity);
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    deallocate(new_data, new_capacity);
+    throw;
+  }
+  deallocate(data_, capacity_);
+  data_ = new_data;
+  capacity_ = new_capacity;
+}
+
+// The new element is constructed in the new buffer before the old ones
+// move, so args may refer to an element of this vector
+template <typename T, typename A, typename G>
+template <typename... Args>
+void Vector<T, A, G>::reallocate_append(Args&&... args) {
+  const size_type new_capacity = grown_capacity();
+  T* new_data = allocate(new_capacity);
+  try {
+    construct(new_data + size_, std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate(new_data, new_capacity);
+    throw;
+  }
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    destroy(new_data + size_, new_data + size_ + 1);
+    deallocate(new_data, new_capacity);
+    throw;
+  }
+  deallocate(data_, capacity_);
   data_ = new_data;
   capacity_ = new_capacity;
+  ++size_;
+}
+
+template <typename T, typename A, typename G>
+typename Vector<T, A, G>::size_type Vector<T, A, G>::grown_capacity() const {
+  return G::next_capacity(capacity_, sizeof(T));
 }
 
+// Removes the elements matching pred in one pass: every kept element moves
+// at most once. Returns the number of removed elements.
+template <typename T, typename A, typename G, typename Pred>
+typename Vector<T, A, G>::size_type erase_if(Vector<T, A, G>& vec,
+                                             Pred pred) {
+  auto first = std::remove_if(vec.begin(), vec.end(), pred);
+  const typename Vector<T, A, G>::size_type removed = vec.end() - first;
+  vec.erase(first, vec.end());
+  return removed;
+}
+
+namespace pmr {
+template <typename T>
+using Vector = s21::Vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // S21_VECTOR_H
@@ -0,0 +1,173 @@
+#ifndef S21_WORK_STEALING_DEQUE_H
+#define S21_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "s21_concurrent_queue.h"
+
+namespace s21 {
+
+// Chase-Lev work-stealing deque (with the memory orderings of Le, Pop,
+// Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak
+// Memory Models"). One owner thread pushes and pops at the bottom like a
+// stack; any number of thieves take the oldest element from the top. The
+// only point where the owner and a thief race is the last element, which
+// both claim with a CAS on top_.
+//
+// The ring grows by doubling when the owner pushes into a full array. A
+// thief may still be reading the old array, so replaced arrays are kept
+// until the deque is destroyed; their total size is below the size of the
+// current one.
+//
+// Slots are read by thieves that may lose the race for them, so T must be
+// trivially copyable (in practice a pointer to a task).
+template <typename T>
+class WorkStealingDeque {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  static_assert(std::is_trivially_copyable<T>::value,
+                "slots are copied by thieves before they win the element");
+
+  // capacity is rounded up to a power of two; the deque grows past it
+  explicit WorkStealingDeque(size_type capacity = 64);
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+  ~WorkStealingDeque();
+
+  // Owner
+  void push(T value);
+  bool pop(T& out);
+
+  // Any thread
+  bool steal(T& out);
+
+  // Snapshots, exact only when no other thread works on the deque
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept;
+  size_type capacity() const noexcept {
+    return array_.load(std::memory_order_relaxed)->capacity();
+  }
+
+ private:
+  using index_type = std::int64_t;
+
+  class Array {
+   public:
+    explicit Array(size_type capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+    Array(const Array&) = delete;
+    Array& operator=(const Array&) = delete;
+    ~Array() { delete[] slots_; }
+
+    size_type capacity() const noexcept { return mask_ + 1; }
+    T get(index_type i) const noexcept {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void put(index_type i, T value) noexcept {
+      slots_[i & mask_].store(value, std::memory_order_relaxed);
+    }
+    // Twice as large, holding the live range [top, bottom)
+    Array* grow(index_type top, index_type bottom) const;
+
+   private:
+    const index_type mask_;
+    std::atomic<T>* const slots_;
+  };
+
+  static constexpr std::size_t kCacheLine = concurrent_queue_detail::kCacheLine;
+
+  alignas(kCacheLine) std::atomic<index_type> top_{0};
+  alignas(kCacheLine) std::atomic<index_type> bottom_{0};
+  std::atomic<Array*> array_;
+  std::vector<Array*> retired_;  // Owner only
+};
+
+template <typename T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::Array::grow(
+    index_type top, index_type bottom) const {
+  Array* bigger = new Array(capacity() * 2);
+  for (index_type i = top; i != bottom; ++i) bigger->put(i, get(i));
+  return bigger;
+}
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type capacity)
+    : array_(new Array(concurrent_queue_detail::round_capacity(capacity))) {}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+  delete array_.load(std::memory_order_relaxed);
+  for (Array* array : retired_) delete array;
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T value) {
+  const index_type bottom = bottom_.load(std::memory_order_relaxed);
+  const index_type top = top_.load(std::memory_order_acquire);
+  Array* array = array_.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<index_type>(array->capacity()) - 1) {
+    retired_.reserve(retired_.size() + 1);
+    Array* bigger = array->grow(top, bottom);
+    retired_.push_back(array);
+    array_.store(bigger, std::memory_order_release);
+    array = bigger;
+  }
+  array->put(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(T& out) {
+  const index_type bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array* array = array_.load(std::memory_order_relaxed);
+  // Reserve the bottom element before looking at top_; the seq_cst pair
+  // orders this against a thief's load of top_ then bottom_
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  index_type top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {  // Was empty
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = array->get(bottom);
+  if (top == bottom) {  // Last element: race the thieves for it
+    const bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& out) {
+  index_type top = top_.load(std::memory_order_seq_cst);
+  const index_type bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  // The slot may be overwritten once another thread takes it; the CAS below
+  // then fails and the stale copy is discarded
+  const T value = array_.load(std::memory_order_acquire)->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  out = value;
+  return true;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::size_type WorkStealingDeque<T>::size()
+    const noexcept {
+  const index_type bottom = bottom_.load(std::memory_order_relaxed);
+  const index_type top = top_.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+}  // namespace s21
+
+#endif  // S21_WORK_STEALING_DEQUE_H
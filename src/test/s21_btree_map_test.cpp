@@ -0,0 +1,203 @@
+#include "../s21_btree_map.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Значение, копирование которого бросает исключение на заданном вызове;
+// перемещение не бросает, поэтому сдвиги внутри узлов безопасны
+struct FragileValue {
+  static inline int countdown = -1;
+
+  explicit FragileValue(int v) : value(v) {}
+  FragileValue(const FragileValue& other) : value(other.value) {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("copy");
+  }
+  FragileValue(FragileValue&& other) noexcept : value(other.value) {}
+  FragileValue& operator=(const FragileValue&) = default;
+
+  int value;
+};
+
+}  // namespace
+
+TEST(BTreeMapTest, Constructors) {
+  s21::BTreeMap<int, std::string> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::BTreeMap<int, std::string> map{{2, "two"}, {1, "one"}, {2, "x"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.begin()->first, 1);
+  EXPECT_EQ(map.at(2), "two");
+
+  s21::BTreeMap<int, std::string> copy(map);
+  copy[3] = "three";
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(copy.size(), 3);
+  s21::BTreeMap<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at(3), "three");
+
+  empty = moved;
+  EXPECT_EQ(empty.size(), 3);
+  empty = std::move(map);
+  EXPECT_EQ(empty.size(), 2);
+}
+
+TEST(BTreeMapTest, AccessAndInsert) {
+  s21::BTreeMap<std::string, int> map;
+  map["b"] = 2;
+  ++map["a"];
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+  EXPECT_TRUE(map.insert({"c", 3}).second);
+  EXPECT_FALSE(map.insert("c", 4).second);
+  EXPECT_FALSE(map.insert_or_assign("c", 5).second);
+  EXPECT_EQ(map.at("c"), 5);
+  EXPECT_FALSE(map.try_emplace("a", 7).second);
+  EXPECT_TRUE(map.try_emplace("d", 7).second);
+  const auto& cmap = map;
+  EXPECT_EQ(cmap.at("d"), 7);
+  EXPECT_TRUE(cmap.contains("b"));
+  EXPECT_EQ(cmap.find("z"), cmap.end());
+}
+
+TEST(BTreeMapTest, OrderedIteration) {
+  s21::BTreeMap<int, int> map;
+  for (int i = 999; i >= 0; --i) map.insert(i * 3, i);
+  int expected = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, expected += 3) {
+    ASSERT_EQ(it->first, expected);
+  }
+  auto it = map.find(2997);
+  for (int key = 2997; key > 0; key -= 3) {
+    ASSERT_EQ((it--)->first, key);
+  }
+  EXPECT_EQ(it, map.begin());
+}
+
+TEST(BTreeMapTest, Bounds) {
+  s21::BTreeMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) map.insert(i * 10, i);
+  EXPECT_EQ(map.lower_bound(-5)->first, 0);
+  EXPECT_EQ(map.lower_bound(10)->first, 10);
+  EXPECT_EQ(map.lower_bound(11)->first, 20);
+  EXPECT_EQ(map.upper_bound(10)->first, 20);
+  EXPECT_EQ(map.lower_bound(9991), map.end());
+  EXPECT_EQ(map.upper_bound(9990), map.end());
+  auto range = map.equal_range(500);
+  EXPECT_EQ(range.first->first, 500);
+  EXPECT_EQ(range.second->first, 510);
+  int count = 0;
+  for (auto it = map.lower_bound(1000); it != map.upper_bound(2000); ++it) {
+    ++count;
+  }
+  EXPECT_EQ(count, 101);
+}
+
+TEST(BTreeMapTest, SwapMerge) {
+  s21::BTreeMap<int, std::string> a{{1, "a1"}, {3, "a3"}};
+  s21::BTreeMap<int, std::string> b{{1, "b1"}, {2, "b2"}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at(1), "a1");
+  EXPECT_EQ(a.at(2), "b2");
+  ASSERT_EQ(b.size(), 1);
+  EXPECT_EQ(b.at(1), "b1");
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1);
+  EXPECT_EQ(b.size(), 3);
+}
+
+// Исключение посреди слияния оставляет оба словаря прежними
+TEST(BTreeMapTest, FailedMergeKeepsContents) {
+  s21::BTreeMap<int, FragileValue> a;
+  s21::BTreeMap<int, FragileValue> b;
+  for (int i = 0; i < 300; ++i) a.insert(2 * i, FragileValue(i));
+  for (int i = 0; i < 300; ++i) b.insert(3 * i, FragileValue(-i));
+  FragileValue::countdown = 150;
+  EXPECT_THROW(a.merge(b), std::runtime_error);
+  FragileValue::countdown = -1;
+  ASSERT_EQ(a.size(), 300);
+  ASSERT_EQ(b.size(), 300);
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_EQ(a.at(2 * i).value, i);
+    ASSERT_EQ(b.at(3 * i).value, -i);
+  }
+  a.merge(b);
+  EXPECT_EQ(a.size(), 500);
+  EXPECT_EQ(b.size(), 100);
+  EXPECT_EQ(a.at(3).value, -1);
+  EXPECT_EQ(b.at(6).value, -2);
+}
+
+// Значение, ссылающееся на элемент того же дерева, копируется до сдвига
+// и разделения узлов
+TEST(BTreeMapTest, InsertAliasedValue) {
+  s21::BTreeMap<int, int> small{{10, 100}, {20, 200}, {30, 300}};
+  EXPECT_TRUE(small.insert(5, small.at(20)).second);
+  EXPECT_EQ(small.at(5), 200);
+  s21::BTreeMap<int, std::vector<int>> map;
+  for (int i = 1; i <= 1000; ++i) map.insert(10 * i, std::vector<int>(8, i));
+  for (int i = 1; i <= 1000; ++i) {
+    const std::vector<int>& value = map.at(10 * i);
+    ASSERT_TRUE(map.try_emplace(10 * i - 5, value).second);
+    ASSERT_TRUE(map.insert_or_assign(10 * i - 3, map.at(10 * i)).second);
+  }
+  for (int i = 1; i <= 1000; ++i) {
+    ASSERT_EQ(map.at(10 * i - 5), std::vector<int>(8, i));
+    ASSERT_EQ(map.at(10 * i - 3), std::vector<int>(8, i));
+  }
+}
+
+// Сравнение с std::map: вставки и удаления перестраивают узлы всех уровней
+template <typename Value>
+static void CheckAgainstStdMap(Value (*make)(int)) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> key_dist(0, 20000);
+  s21::BTreeMap<int, Value> map;
+  std::map<int, Value> expected;
+  for (int i = 0; i < 200000; ++i) {
+    int key = key_dist(gen);
+    if (gen() % 5 < 3) {
+      ASSERT_EQ(map.insert(key, make(i)).second,
+                expected.insert({key, make(i)}).second);
+    } else if (gen() % 2) {
+      ASSERT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      auto it = map.lower_bound(key);
+      auto reference = expected.lower_bound(key);
+      if (reference == expected.end()) {
+        ASSERT_EQ(it, map.end());
+      } else {
+        ASSERT_EQ(it->first, reference->first);
+        map.erase(it);
+        expected.erase(reference);
+      }
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  auto reference = expected.begin();
+  for (auto it = map.begin(); it != map.end(); ++it, ++reference) {
+    ASSERT_EQ(it->first, reference->first);
+    ASSERT_EQ(it->second, reference->second);
+  }
+  while (!map.empty()) map.erase(map.begin());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(BTreeMapTest, RandomOperationsTrivial) {
+  CheckAgainstStdMap<int>([](int i) { return i; });
+}
+
+TEST(BTreeMapTest, RandomOperationsString) {
+  CheckAgainstStdMap<std::string>(
+      [](int i) { return std::string(20, 'a' + i % 26); });
+}
@@ -0,0 +1,100 @@
+#include "../s21_btree_set.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Ключ, копирование которого бросает исключение на заданном вызове;
+// перемещение не бросает, поэтому сдвиги внутри узлов безопасны
+struct FragileKey {
+  static inline int countdown = -1;
+
+  explicit FragileKey(int v) : value(v) {}
+  FragileKey(const FragileKey& other) : value(other.value) {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("copy");
+  }
+  FragileKey(FragileKey&& other) noexcept : value(other.value) {}
+  FragileKey& operator=(const FragileKey&) = default;
+  bool operator<(const FragileKey& other) const { return value < other.value; }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(BTreeSetTest, Constructors) {
+  s21::BTreeSet<int> empty;
+  EXPECT_TRUE(empty.empty());
+  s21::BTreeSet<int> set{3, 1, 2, 1};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_EQ(*set.begin(), 1);
+  s21::BTreeSet<int> copy(set);
+  EXPECT_TRUE(copy.contains(3));
+  s21::BTreeSet<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  empty = moved;
+  EXPECT_EQ(empty.size(), 3);
+}
+
+TEST(BTreeSetTest, InsertEraseFind) {
+  s21::BTreeSet<std::string> set;
+  EXPECT_TRUE(set.insert("b").second);
+  EXPECT_FALSE(set.insert("b").second);
+  EXPECT_TRUE(set.insert(std::string("a")).second);
+  EXPECT_EQ(*set.begin(), "a");
+  EXPECT_EQ(*set.lower_bound("aa"), "b");
+  EXPECT_EQ(set.upper_bound("b"), set.end());
+  set.erase(set.find("a"));
+  EXPECT_FALSE(set.contains("a"));
+  EXPECT_EQ(set.erase("b"), 1);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(BTreeSetTest, Merge) {
+  s21::BTreeSet<int> a{1, 2};
+  s21::BTreeSet<int> b{2, 3};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.contains(2));
+}
+
+TEST(BTreeSetTest, FailedMergeKeepsContents) {
+  s21::BTreeSet<FragileKey> a;
+  s21::BTreeSet<FragileKey> b;
+  for (int i = 0; i < 300; ++i) a.insert(FragileKey(2 * i));
+  for (int i = 0; i < 300; ++i) b.insert(FragileKey(3 * i));
+  FragileKey::countdown = 150;
+  EXPECT_THROW(a.merge(b), std::runtime_error);
+  FragileKey::countdown = -1;
+  ASSERT_EQ(a.size(), 300);
+  ASSERT_EQ(b.size(), 300);
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_TRUE(a.contains(FragileKey(2 * i)));
+    ASSERT_TRUE(b.contains(FragileKey(3 * i)));
+  }
+  a.merge(b);
+  EXPECT_EQ(a.size(), 500);
+  EXPECT_EQ(b.size(), 100);
+  EXPECT_TRUE(b.contains(FragileKey(6)));
+}
+
+TEST(BTreeSetTest, Large) {
+  s21::BTreeSet<std::string> set;
+  std::set<std::string> expected;
+  for (int i = 0; i < 50000; ++i) {
+    std::string key = std::to_string((i * 7919) % 30011);
+    EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    if (i % 3 == 0) {
+      std::string other = std::to_string(i % 30011);
+      EXPECT_EQ(set.erase(other), expected.erase(other));
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  auto reference = expected.begin();
+  for (const auto& key : set) EXPECT_EQ(key, *reference++);
+}
@@ -0,0 +1,197 @@
+#include "../s21_concurrent_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(SpscQueueTest, PushPopInOrder) {
+  s21::SpscQueue<std::string> q(3);
+  ASSERT_EQ(q.capacity(), 4);
+  ASSERT_TRUE(q.empty());
+  ASSERT_THROW(q.front(), std::runtime_error);
+  ASSERT_THROW(q.pop(), std::runtime_error);
+  for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(std::to_string(i)));
+  ASSERT_FALSE(q.try_push("full"));
+  ASSERT_EQ(q.size(), 4);
+  ASSERT_EQ(q.front(), "0");
+  q.pop();
+  std::string out;
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(out, "1");
+  ASSERT_TRUE(q.try_emplace(3, 'x'));
+  ASSERT_EQ(q.size(), 3);
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(out, "xxx");
+  ASSERT_FALSE(q.try_pop(out));
+}
+
+TEST(SpscQueueTest, BatchesWrapAround) {
+  s21::SpscQueue<int> q(8);
+  std::vector<int> in{1, 2, 3, 4, 5, 6};
+  ASSERT_EQ(q.push_many(in.begin(), in.end()), 6);
+  int out[8];
+  ASSERT_EQ(q.pop_many(out, 4), 4);
+  ASSERT_EQ(out[3], 4);
+  // Only 6 of the 10 fit, across the end of the ring
+  std::vector<int> more{7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  ASSERT_EQ(q.push_many(more.begin(), more.end()), 6);
+  ASSERT_EQ(q.size(), 8);
+  ASSERT_EQ(q.pop_many(out, 8), 8);
+  ASSERT_EQ(out[0], 5);
+  ASSERT_EQ(out[7], 12);
+  ASSERT_EQ(q.pop_many(out, 8), 0);
+}
+
+TEST(SpscQueueTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::SpscQueue<std::shared_ptr<int>> q(4);
+    q.try_push(counter);
+    q.try_push(counter);
+    ASSERT_EQ(counter.use_count(), 3);
+  }
+  ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(SpscQueueTest, TwoThreads) {
+  constexpr int kCount = 200000;
+  s21::SpscQueue<int> q(64);
+  std::thread producer([&q] {
+    int batch[16];
+    for (int i = 0; i < kCount;) {
+      if (i % 3 == 0) {
+        int n = 0;
+        for (; n < 16 && i + n < kCount; ++n) batch[n] = i + n;
+        i += static_cast<int>(q.push_many(batch, batch + n));
+      } else if (q.try_push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  int batch[16];
+  while (expected < kCount) {
+    std::size_t n = q.pop_many(batch, 16);
+    if (n == 0) std::this_thread::yield();
+    for (std::size_t k = 0; k < n; ++k) ASSERT_EQ(batch[k], expected++);
+  }
+  producer.join();
+  ASSERT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, SingleThread) {
+  s21::MpmcQueue<std::string> q(4);
+  ASSERT_EQ(q.capacity(), 4);
+  for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(std::to_string(i)));
+  ASSERT_FALSE(q.try_emplace("full"));
+  ASSERT_EQ(q.size(), 4);
+  std::string out;
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(out, "0");
+  std::string batch[4];
+  ASSERT_EQ(q.pop_many(batch, 4), 3);
+  ASSERT_EQ(batch[2], "3");
+  ASSERT_TRUE(q.empty());
+  ASSERT_FALSE(q.try_pop(out));
+  std::vector<std::string> in{"a", "b", "c", "d", "e"};
+  ASSERT_EQ(q.push_many(in.begin(), in.end()), 4);
+}
+
+TEST(MpmcQueueTest, BatchClaimsStopAtFull) {
+  s21::MpmcQueue<int> q(8);
+  std::vector<int> in(12);
+  for (int i = 0; i < 12; ++i) in[i] = i;
+  ASSERT_EQ(q.push_many(in.begin(), in.begin() + 5), 5);
+  ASSERT_EQ(q.push_many(in.begin() + 5, in.end()), 3);
+  int out[12];
+  ASSERT_EQ(q.pop_many(out, 12), 8);
+  for (int i = 0; i < 8; ++i) ASSERT_EQ(out[i], i);
+}
+
+// Output iterator that throws on the write after the first limit ones
+struct LimitedOutput {
+  std::vector<std::string>* sink;
+  std::size_t limit;
+
+  LimitedOutput& operator*() { return *this; }
+  LimitedOutput& operator++() { return *this; }
+  LimitedOutput& operator=(std::string&& value) {
+    if (sink->size() == limit) throw std::length_error("sink full");
+    sink->push_back(std::move(value));
+    return *this;
+  }
+};
+
+TEST(MpmcQueueTest, ThrowingOutputReleasesCells) {
+  s21::MpmcQueue<std::string> q(4);
+  for (int i = 0; i < 4; ++i) q.try_push(std::string(30, 'a' + i));
+  std::vector<std::string> sink;
+  ASSERT_THROW(q.pop_many(LimitedOutput{&sink, 2}, 4), std::length_error);
+  ASSERT_EQ(sink.size(), 2);
+  ASSERT_EQ(sink[1], std::string(30, 'b'));
+  ASSERT_TRUE(q.empty());
+  // Every cell is usable again
+  for (int i = 0; i < 4; ++i) ASSERT_TRUE(q.try_push(std::to_string(i)));
+  std::string out;
+  ASSERT_TRUE(q.try_pop(out));
+  ASSERT_EQ(out, "0");
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  constexpr int kProducers = 3;
+  constexpr int kConsumers = 3;
+  constexpr int kPerProducer = 50000;
+  s21::MpmcQueue<int> q(128);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      int batch[8];
+      for (int i = 0; i < kPerProducer;) {
+        int n = 0;
+        for (; n < 8 && i + n < kPerProducer; ++n) {
+          batch[n] = p * kPerProducer + i + n;
+        }
+        int pushed = static_cast<int>(q.push_many(batch, batch + n));
+        if (pushed == 0) std::this_thread::yield();
+        i += pushed;
+      }
+    });
+  }
+  std::vector<std::vector<int>> seen(kConsumers);
+  std::atomic<int> consumed{0};
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&, c] {
+      int value;
+      while (consumed.load() < kProducers * kPerProducer) {
+        if (q.try_pop(value)) {
+          seen[c].push_back(value);
+          ++consumed;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::vector<int> counts(kProducers * kPerProducer, 0);
+  for (const auto& values : seen) {
+    // Values of one producer reach a consumer in the order they were pushed
+    std::vector<int> last(kProducers, -1);
+    for (int value : values) {
+      ++counts[value];
+      ASSERT_GT(value, last[value / kPerProducer]);
+      last[value / kPerProducer] = value;
+    }
+  }
+  for (int count : counts) ASSERT_EQ(count, 1);
+  ASSERT_TRUE(q.empty());
+}
@@ -0,0 +1,109 @@
+#include "../s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(DequeTest, Constructors) {
+  s21::Deque<int> d1, d2{1, 2, 3}, d3(d2);
+  ASSERT_EQ(d1.size(), 0);
+  ASSERT_EQ(d1.capacity(), 0);
+  ASSERT_EQ(d2.size(), 3);
+  ASSERT_EQ(d3.size(), 3);
+  ASSERT_EQ(d3[2], 3);
+  s21::Deque<int> d4(std::move(d3));
+  ASSERT_EQ(d3.size(), 0);
+  ASSERT_EQ(d4.front(), 1);
+  d1 = d4;
+  ASSERT_EQ(d1.back(), 3);
+  d1 = std::move(d4);
+  ASSERT_EQ(d1.size(), 3);
+}
+
+TEST(DequeTest, ElementAccess) {
+  s21::Deque<int> d{1, 2, 3};
+  ASSERT_EQ(d.front(), 1);
+  ASSERT_EQ(d.back(), 3);
+  ASSERT_EQ(d.at(1), 2);
+  ASSERT_THROW(d.at(3), std::out_of_range);
+  s21::Deque<int> empty;
+  ASSERT_THROW(empty.front(), std::runtime_error);
+  ASSERT_THROW(empty.pop_front(), std::runtime_error);
+}
+
+TEST(DequeTest, PowerOfTwoCapacity) {
+  s21::Deque<int> d;
+  d.reserve(5);
+  ASSERT_EQ(d.capacity(), 8);
+  for (int i = 0; i < 9; ++i) d.push_back(i);
+  ASSERT_EQ(d.capacity(), 16);
+}
+
+TEST(DequeTest, WrapAroundAndGrow) {
+  s21::Deque<int> d;
+  d.reserve(4);
+  int next = 0, expected = 0;
+  // Advance the head so that the live range wraps, then force growth
+  for (int round = 0; round < 3; ++round) {
+    d.push_back(next++);
+    d.push_back(next++);
+    d.push_back(next++);
+    ASSERT_EQ(d.front(), expected++);
+    d.pop_front();
+    ASSERT_EQ(d.front(), expected++);
+    d.pop_front();
+  }
+  for (int i = 0; i < 10; ++i) d.push_back(next++);
+  int count = 0;
+  for (auto it = d.begin(); it != d.end(); ++it, ++count) {
+    ASSERT_EQ(*it, expected + count);
+  }
+  ASSERT_EQ(count, next - expected);
+}
+
+TEST(DequeTest, PushPopBothEnds) {
+  s21::Deque<std::string> d;
+  for (int i = 0; i < 50; ++i) {
+    d.push_back(std::to_string(i));
+    d.push_front(std::to_string(-i));
+  }
+  ASSERT_EQ(d.size(), 100);
+  ASSERT_EQ(d.front(), "-49");
+  ASSERT_EQ(d.back(), "49");
+  d.push_back(d.front());
+  ASSERT_EQ(d.back(), "-49");
+  d.pop_back();
+  d.pop_front();
+  ASSERT_EQ(d.front(), "-48");
+  d.clear();
+  ASSERT_TRUE(d.empty());
+}
+
+TEST(DequeTest, SteadyStateDoesNotGrow) {
+  s21::Deque<int> d;
+  for (int i = 0; i < 64; ++i) d.push_back(i);
+  const size_t capacity = d.capacity();
+  for (int i = 0; i < 100000; ++i) {
+    d.pop_front();
+    d.push_back(i);
+  }
+  ASSERT_EQ(d.capacity(), capacity);
+  ASSERT_EQ(d.size(), 64);
+}
+
+TEST(DequeTest, EmplaceAndMove) {
+  s21::Deque<std::string> d;
+  EXPECT_EQ(d.emplace_back(2, 'b'), "bb");
+  EXPECT_EQ(d.emplace_front("a"), "a");
+  std::string long_string(40, 'c');
+  const char* buffer = long_string.data();
+  d.push_back(std::move(long_string));
+  EXPECT_EQ(d.back().data(), buffer);
+  // Full: the argument refers to an element of the buffer being replaced
+  while (d.size() < d.capacity()) d.push_back("x");
+  d.emplace_front(d.back());
+  d.push_back(d[1]);
+  EXPECT_EQ(d.front(), "x");
+  EXPECT_EQ(d.back(), "a");
+  EXPECT_EQ(d[3], std::string(40, 'c'));
+}
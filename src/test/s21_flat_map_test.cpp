@@ -0,0 +1,214 @@
+#include "../s21_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template <class Container>
+std::vector<typename Container::value_type> ToStd(const Container& c) {
+  return {c.begin(), c.end()};
+}
+
+// Counts copies and throws from the copy that copies_left runs out on.
+// Its move may throw too, so FlatMap has to copy it when merging
+struct Payload {
+  static int copies;
+  static int copies_left;
+  int value;
+
+  Payload(int v = 0) : value(v) {}
+  Payload(const Payload& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++copies;
+  }
+  Payload(Payload&& other) noexcept(false) : value(other.value) {
+    other.value = -1;
+  }
+  Payload& operator=(const Payload& other) = default;
+  Payload& operator=(Payload&& other) = default;
+};
+int Payload::copies = 0;
+int Payload::copies_left = -1;
+
+}  // namespace
+
+TEST(FlatMapTest, InsertFindAndAccess) {
+  s21::FlatMap<int, std::string> m;
+  ASSERT_TRUE(m.empty());
+  ASSERT_TRUE(m.insert(5, "five").second);
+  ASSERT_TRUE(m.insert({1, "one"}).second);
+  ASSERT_FALSE(m.insert(5, "FIVE").second);
+  m[3] = "three";
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_EQ(m.at(5), "five");
+  ASSERT_THROW(m.at(4), std::out_of_range);
+  ASSERT_TRUE(m.contains(3));
+  ASSERT_FALSE(m.contains(2));
+  auto it = m.find(3);
+  ASSERT_EQ(it->first, 3);
+  it->second += "!";
+  ASSERT_EQ(m.at(3), "three!");
+  ASSERT_EQ(m.find(4), m.end());
+  ASSERT_EQ(m.insert_or_assign(5, "FIVE").first->second, "FIVE");
+  ASSERT_FALSE(m.try_emplace(1, 3, 'x').second);
+  ASSERT_EQ(m.try_emplace(2, 3, 'x').first->second, "xxx");
+  ASSERT_EQ(ToStd(m.keys()), (std::vector<int>{1, 2, 3, 5}));
+  ASSERT_EQ(m.values()[1], "xxx");
+}
+
+TEST(FlatMapTest, IteratorIsRandomAccess) {
+  s21::FlatMap<int, int> m{{3, 30}, {1, 10}, {2, 20}, {4, 40}};
+  auto it = m.begin();
+  ASSERT_EQ((it + 2)->second, 30);
+  ASSERT_EQ(it[3].first, 4);
+  ASSERT_EQ(m.end() - m.begin(), 4);
+  s21::FlatMap<int, int>::const_iterator cit = it;
+  ASSERT_TRUE(cit == it);
+  ASSERT_TRUE(it + 1 > cit);
+  int sum = 0;
+  for (auto [key, value] : m) sum += key * value;
+  ASSERT_EQ(sum, 10 + 40 + 90 + 160);
+  for (auto entry : m) entry.second = 0;
+  ASSERT_EQ(m.at(4), 0);
+  const auto& cm = m;
+  auto found = std::lower_bound(
+      cm.begin(), cm.end(), 3,
+      [](const auto& entry, int key) { return entry.first < key; });
+  ASSERT_EQ(found->first, 3);
+}
+
+TEST(FlatMapTest, BatchConstructionKeepsFirstDuplicate) {
+  std::vector<std::pair<int, std::string>> items{
+      {5, "a"}, {1, "b"}, {5, "c"}, {3, "d"}, {1, "e"}};
+  s21::FlatMap<int, std::string> m(items.begin(), items.end());
+  ASSERT_EQ(m.size(), 3);
+  ASSERT_EQ(m.at(5), "a");
+  ASSERT_EQ(m.at(1), "b");
+  std::vector<std::pair<int, std::string>> more{{2, "f"}, {5, "g"}, {9, "h"}};
+  m.insert(more.begin(), more.end());
+  ASSERT_EQ(ToStd(m.keys()), (std::vector<int>{1, 2, 3, 5, 9}));
+  ASSERT_EQ(m.at(5), "a");  // Existing entries win
+  ASSERT_EQ(m.at(9), "h");
+}
+
+TEST(FlatMapTest, EraseAndBounds) {
+  s21::FlatMap<int, int> m{{10, 1}, {20, 2}, {30, 3}, {40, 4}};
+  ASSERT_EQ(m.lower_bound(20)->first, 20);
+  ASSERT_EQ(m.upper_bound(20)->first, 30);
+  ASSERT_EQ(m.lower_bound(25)->first, 30);
+  ASSERT_EQ(m.upper_bound(40), m.end());
+  ASSERT_EQ(m.lower_bound(5), m.begin());
+  auto range = m.equal_range(30);
+  ASSERT_EQ(range.second - range.first, 1);
+  m.erase(m.find(20));
+  ASSERT_EQ(m.erase(30), 1);
+  ASSERT_EQ(m.erase(30), 0);
+  ASSERT_EQ(ToStd(m.keys()), (std::vector<int>{10, 40}));
+  ASSERT_EQ(ToStd(m.values()), (std::vector<int>{1, 4}));
+  m.clear();
+  ASSERT_TRUE(m.empty());
+  ASSERT_EQ(m.begin(), m.end());
+}
+
+TEST(FlatMapTest, MergeLeavesDuplicatesInOther) {
+  s21::FlatMap<int, std::string> a{{1, "a1"}, {3, "a3"}};
+  s21::FlatMap<int, std::string> b{{2, "b2"}, {3, "b3"}, {4, "b4"}};
+  a.merge(b);
+  ASSERT_EQ(ToStd(a.keys()), (std::vector<int>{1, 2, 3, 4}));
+  ASSERT_EQ(a.at(3), "a3");
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(b.at(3), "b3");
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+}
+
+TEST(FlatMapTest, MatchesStdMap) {
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<int> dist(0, 2000);
+  s21::FlatMap<int, int> flat;
+  std::map<int, int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    const int key = dist(rng);
+    if (i % 4 == 0) {
+      ASSERT_EQ(flat.erase(key), expected.erase(key));
+    } else {
+      flat[key] += i;
+      expected[key] += i;
+    }
+  }
+  ASSERT_EQ(flat.size(), expected.size());
+  auto it = flat.begin();
+  for (const auto& [key, value] : expected) {
+    ASSERT_EQ(it->first, key);
+    ASSERT_EQ(it->second, value);
+    ++it;
+  }
+  for (int key = -1; key <= 2001; key += 7) {
+    auto lower = flat.lower_bound(key);
+    auto expected_lower = expected.lower_bound(key);
+    ASSERT_EQ(lower == flat.end(), expected_lower == expected.end());
+    if (lower != flat.end()) {
+      ASSERT_EQ(lower->first, expected_lower->first);
+    }
+    auto upper = flat.upper_bound(key);
+    auto expected_upper = expected.upper_bound(key);
+    ASSERT_EQ(upper == flat.end(), expected_upper == expected.end());
+    if (upper != flat.end()) {
+      ASSERT_EQ(upper->first, expected_upper->first);
+    }
+  }
+}
+
+TEST(FlatMapTest, EmplaceBuildsValueInPlace) {
+  s21::FlatMap<int, Payload> map;
+  map.reserve(8);
+  Payload::copies = 0;
+  map.try_emplace(5, 50);
+  map.try_emplace(1, 10);
+  map[3].value = 30;
+  EXPECT_EQ(Payload::copies, 0);
+  EXPECT_EQ(map.at(1).value, 10);
+  EXPECT_EQ(map.at(3).value, 30);
+  EXPECT_EQ(map.at(5).value, 50);
+}
+
+TEST(FlatMapTest, FailedBatchInsertAndMergeKeepContents) {
+  s21::FlatMap<int, Payload> map;
+  for (int i = 0; i < 10; ++i) map.try_emplace(2 * i, i);
+  std::vector<std::pair<int, Payload>> batch;
+  for (int i = 0; i < 10; ++i) batch.emplace_back(2 * i + 1, 100 + i);
+  Payload::copies_left = 15;
+  EXPECT_THROW(map.insert(batch.begin(), batch.end()), std::runtime_error);
+  s21::FlatMap<int, Payload> other;
+  for (int i = 0; i < 5; ++i) other.try_emplace(4 * i + 1, 200 + i);
+  Payload::copies_left = 8;
+  EXPECT_THROW(map.merge(other), std::runtime_error);
+  Payload::copies_left = -1;
+  ASSERT_EQ(map.size(), 10);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(map.at(2 * i).value, i);
+  ASSERT_EQ(other.size(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(other.at(4 * i + 1).value, 200 + i);
+  map.merge(other);
+  EXPECT_EQ(map.size(), 15);
+  EXPECT_TRUE(other.empty());
+}
+
+// Keys and values that move without throwing are moved, not copied
+TEST(FlatMapTest, MergeMovesNothrowElements) {
+  s21::FlatMap<int, std::string> map = {{1, std::string(40, 'a')}};
+  s21::FlatMap<int, std::string> other = {{2, std::string(40, 'b')},
+                                          {1, "kept"}};
+  const char* buffer = map.at(1).data();
+  map.merge(other);
+  EXPECT_EQ(map.at(1).data(), buffer);
+  EXPECT_EQ(map.at(2), std::string(40, 'b'));
+  EXPECT_EQ(other.at(1), "kept");
+}
@@ -0,0 +1,91 @@
+#include "../s21_flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <class Container>
+std::vector<typename Container::value_type> ToStd(const Container& c) {
+  return {c.begin(), c.end()};
+}
+
+// Key whose copy throws once copies_left runs out and whose move may
+// throw, so FlatSet copies its own keys when merging
+struct FragileKey {
+  static int copies_left;
+  int value;
+
+  FragileKey(int v) : value(v) {}
+  FragileKey(const FragileKey& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  FragileKey(FragileKey&& other) noexcept(false) : value(other.value) {
+    other.value = -1;
+  }
+  FragileKey& operator=(const FragileKey& other) = default;
+  FragileKey& operator=(FragileKey&& other) = default;
+  bool operator<(const FragileKey& other) const {
+    return value < other.value;
+  }
+};
+int FragileKey::copies_left = -1;
+
+}  // namespace
+
+TEST(FlatSetTest, InsertEraseAndSearch) {
+  s21::FlatSet<std::string> s{"pear", "apple", "fig", "apple"};
+  ASSERT_EQ(s.size(), 3);
+  ASSERT_EQ(*s.begin(), "apple");
+  ASSERT_FALSE(s.insert("fig").second);
+  ASSERT_EQ(*s.insert("kiwi").first, "kiwi");
+  ASSERT_TRUE(s.contains("kiwi"));
+  ASSERT_EQ(s.find("plum"), s.end());
+  ASSERT_EQ(*s.lower_bound("b"), "fig");
+  ASSERT_EQ(s.upper_bound("pear"), s.end());
+  ASSERT_EQ(s.erase("fig"), 1);
+  s.erase(s.begin());
+  ASSERT_EQ(ToStd(s), (std::vector<std::string>{"kiwi", "pear"}));
+  // Contiguous: plain pointer arithmetic over the elements
+  ASSERT_EQ(&*s.begin() + 1, &*(s.end() - 1));
+}
+
+TEST(FlatSetTest, BatchInsertAndMerge) {
+  std::vector<int> items{9, 3, 7, 3, 1};
+  s21::FlatSet<int> a(items.begin(), items.end());
+  std::vector<int> more{2, 9, 8};
+  a.insert(more.begin(), more.end());
+  ASSERT_EQ(ToStd(a), (std::vector<int>{1, 2, 3, 7, 8, 9}));
+  s21::FlatSet<int> b{0, 3, 10};
+  a.merge(b);
+  ASSERT_EQ(a.size(), 8);
+  ASSERT_EQ(ToStd(b), (std::vector<int>{3}));
+}
+
+TEST(FlatSetTest, FailedMergeKeepsContents) {
+  s21::FlatSet<FragileKey> set;
+  s21::FlatSet<FragileKey> other;
+  for (int i = 0; i < 10; ++i) {
+    set.insert(FragileKey(2 * i));
+    other.insert(FragileKey(3 * i));
+  }
+  std::vector<FragileKey> batch;
+  for (int i = 0; i < 10; ++i) batch.emplace_back(2 * i + 1);
+  FragileKey::copies_left = 14;
+  EXPECT_THROW(set.insert(batch.begin(), batch.end()), std::runtime_error);
+  FragileKey::copies_left = 6;
+  EXPECT_THROW(set.merge(other), std::runtime_error);
+  FragileKey::copies_left = -1;
+  ASSERT_EQ(set.size(), 10);
+  ASSERT_EQ(other.size(), 10);
+  int i = 0;
+  for (const FragileKey& key : set) EXPECT_EQ(key.value, 2 * i++);
+  i = 0;
+  for (const FragileKey& key : other) EXPECT_EQ(key.value, 3 * i++);
+  set.merge(other);
+  EXPECT_EQ(set.size(), 16);
+  EXPECT_EQ(other.size(), 4);
+}
@@ -0,0 +1,132 @@
+#include "../s21_incremental_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Enough ints to pass kEagerBytes, so growth goes through a migration
+constexpr int kLarge = 1 << 16;
+
+namespace {
+
+// Copyable element without a move constructor, so migration copies it;
+// once fail_copies is set, copying a non-negative value throws
+struct FragileCopy {
+  static inline bool fail_copies = false;
+
+  explicit FragileCopy(int v) : value(v) {}
+  FragileCopy(const FragileCopy& other) : value(other.value) {
+    if (fail_copies && value >= 0) throw std::runtime_error("copy failed");
+  }
+  FragileCopy& operator=(const FragileCopy&) = default;
+
+  int value;
+};
+
+}  // namespace
+
+TEST(IncrementalVectorTest, PushBackMigratesGradually) {
+  s21::IncrementalVector<int> vec;
+  bool saw_growing = false;
+  for (int i = 0; i < 4 * kLarge; ++i) {
+    vec.push_back(i);
+    saw_growing = saw_growing || vec.is_growing();
+    ASSERT_EQ(vec[i / 2], i / 2);
+  }
+  EXPECT_TRUE(saw_growing);
+  EXPECT_EQ(vec.size(), 4 * kLarge);
+  for (int i = 0; i < 4 * kLarge; ++i) ASSERT_EQ(vec[i], i);
+  EXPECT_EQ(vec.front(), 0);
+  EXPECT_EQ(vec.back(), 4 * kLarge - 1);
+  EXPECT_THROW(vec.at(4 * kLarge), std::out_of_range);
+}
+
+TEST(IncrementalVectorTest, DataFinishesGrowth) {
+  s21::IncrementalVector<int> vec;
+  for (int i = 0; i <= kLarge; ++i) vec.push_back(i);
+  ASSERT_TRUE(vec.is_growing());
+  const int* data = vec.data();
+  EXPECT_FALSE(vec.is_growing());
+  EXPECT_TRUE(std::is_sorted(data, data + vec.size()));
+  EXPECT_EQ(data[kLarge], kLarge);
+}
+
+TEST(IncrementalVectorTest, PopBackDuringMigration) {
+  s21::IncrementalVector<std::string, std::allocator<std::string>,
+                         s21::GrowOneAndHalf>
+      vec;
+  const int count = 8192;
+  for (int i = 0; i <= count; ++i) vec.push_back(std::to_string(i));
+  ASSERT_TRUE(vec.is_growing());
+  for (int i = 0; i < 100; ++i) vec.pop_back();
+  vec.push_back("tail");
+  EXPECT_EQ(vec.size(), count - 98);
+  for (int i = 0; i < count - 99; ++i) ASSERT_EQ(vec[i], std::to_string(i));
+  EXPECT_EQ(vec.back(), "tail");
+  while (vec.size() > 10) vec.pop_back();
+  EXPECT_FALSE(vec.is_growing());
+  EXPECT_EQ(vec[9], "9");
+}
+
+TEST(IncrementalVectorTest, IteratorsSpanBothBuffers) {
+  s21::IncrementalVector<int> vec;
+  for (int i = 0; i <= kLarge; ++i) vec.push_back(kLarge - i);
+  ASSERT_TRUE(vec.is_growing());
+  long sum = 0;
+  for (int value : vec) sum += value;
+  EXPECT_EQ(sum, static_cast<long>(kLarge) * (kLarge + 1) / 2);
+  std::sort(vec.begin(), vec.end());
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  s21::IncrementalVector<int>::const_iterator it = vec.begin() + 5;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(vec.end() - it, kLarge - 4);
+}
+
+TEST(IncrementalVectorTest, CopyMoveSwap) {
+  s21::IncrementalVector<std::string> vec;
+  for (int i = 0; i <= 4096; ++i) vec.push_back(std::to_string(i));
+  s21::IncrementalVector<std::string> copy(vec);
+  EXPECT_FALSE(copy.is_growing());
+  EXPECT_EQ(copy.size(), vec.size());
+  EXPECT_EQ(copy[4096], "4096");
+  s21::IncrementalVector<std::string> moved(std::move(vec));
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(moved[100], "100");
+  vec.push_back("again");
+  vec.swap(moved);
+  EXPECT_EQ(vec.size(), 4097);
+  EXPECT_EQ(moved.size(), 1);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 1);
+  EXPECT_EQ(copy[0], "again");
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_FALSE(vec.is_growing());
+}
+
+TEST(IncrementalVectorTest, ReserveSettles) {
+  s21::IncrementalVector<int> vec;
+  for (int i = 0; i <= kLarge; ++i) vec.push_back(i);
+  vec.reserve(4 * kLarge);
+  EXPECT_FALSE(vec.is_growing());
+  EXPECT_EQ(vec.capacity(), 4 * kLarge);
+  EXPECT_EQ(vec[kLarge], kLarge);
+}
+
+TEST(IncrementalVectorTest, ThrowingMigrationKeepsSize) {
+  s21::IncrementalVector<FragileCopy> vec;
+  for (int i = 0; i <= kLarge; ++i) vec.push_back(FragileCopy(i));
+  ASSERT_TRUE(vec.is_growing());
+  FragileCopy::fail_copies = true;
+  EXPECT_THROW(vec.push_back(FragileCopy(-1)), std::runtime_error);
+  FragileCopy::fail_copies = false;
+  EXPECT_EQ(vec.size(), kLarge + 1);
+  EXPECT_EQ(vec.back().value, kLarge);
+  vec.push_back(FragileCopy(-1));
+  EXPECT_EQ(vec.size(), kLarge + 2);
+  for (int i = 0; i <= kLarge; ++i) ASSERT_EQ(vec[i].value, i);
+  EXPECT_EQ(vec.back().value, -1);
+}
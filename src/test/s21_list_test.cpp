@@ -1,6 +1,10 @@
 #include "../s21_list.h"
 
 #include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
 TEST(ListTest, Constructors) {
   size_t count = 0;
   s21::List<int> l1, l2(5), l3{0, 1, 2, 3, 4, 5};
@@ -239,3 +243,113 @@ TEST(ListTest, Sort) {
     count++;
   }
 }
+
+TEST(ListTest, SortLarge) {
+  s21::List<int> list;
+  unsigned state = 7;
+  for (int i = 0; i < 100001; ++i) {
+    state = state * 1103515245u + 12345u;
+    list.push_back(static_cast<int>(state >> 16));
+  }
+  list.sort();
+  ASSERT_EQ(list.size(), 100001);
+  auto prev = list.cbegin();
+  for (auto it = ++list.cbegin(); it != list.cend(); ++it, ++prev) {
+    ASSERT_LE(*prev, *it);
+  }
+  ASSERT_EQ(*(--list.cend()), *list.crbegin());
+  size_t count = 0;
+  for (auto it = list.crbegin(); it != list.crend(); ++it) ++count;
+  ASSERT_EQ(count, 100001);
+}
+
+TEST(ListTest, SortCompareStable) {
+  s21::List<std::pair<int, int>> list;
+  for (int i = 0; i < 100; ++i) list.push_back({i % 7, i});
+  list.sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first > b.first;
+  });
+  auto prev = list.cbegin();
+  for (auto it = ++list.cbegin(); it != list.cend(); ++it, ++prev) {
+    ASSERT_GE((*prev).first, (*it).first);
+    if ((*prev).first == (*it).first) {
+      ASSERT_LT((*prev).second, (*it).second);
+    }
+  }
+}
+
+TEST(ListTest, PoolRecyclesNodes) {
+  s21::PooledList<int> l;
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 1000; ++i) l.push_back(i);
+    while (!l.empty()) l.pop_front();
+  }
+  const auto& stats = l.get_allocator().stats();
+  ASSERT_EQ(stats.node_allocations, 10000);
+  ASSERT_EQ(stats.node_deallocations, 10000);
+  ASSERT_LT(stats.system_allocations, 10);
+  l.clear();
+  ASSERT_EQ(stats.system_allocations, stats.system_deallocations);
+}
+
+TEST(ListTest, PoolClearDestroysElements) {
+  s21::PooledList<std::string> l;
+  for (int i = 0; i < 100; ++i) l.push_front(std::string(64, 'a' + i % 26));
+  l.clear();
+  ASSERT_TRUE(l.empty());
+  l.push_back("again");
+  ASSERT_EQ(l.front(), "again");
+}
+
+TEST(ListTest, PoolSpliceMerge) {
+  s21::PooledList<int> l1{1, 3, 5};
+  {
+    s21::PooledList<int> l2{2, 4, 6};
+    l1.merge(l2);
+    s21::PooledList<int> l3{7, 8};
+    l1.splice(l1.cend(), l3);
+  }
+  int expected = 1;
+  for (auto it = l1.cbegin(); it != l1.cend(); ++it) ASSERT_EQ(*it, expected++);
+  ASSERT_EQ(l1.size(), 8);
+  s21::PooledList<int> l4(std::move(l1));
+  l4.erase(l4.begin());
+  ASSERT_EQ(l4.front(), 2);
+}
+
+TEST(ListTest, NewAllocatorStats) {
+  s21::List<int> l{1, 2, 3};
+  l.pop_back();
+  ASSERT_EQ(l.get_allocator().stats().system_allocations, 3);
+  ASSERT_EQ(l.get_allocator().stats().system_deallocations, 1);
+}
+
+TEST(ListTest, EmplaceAndMove) {
+  s21::List<std::string> l;
+  EXPECT_EQ(l.emplace_back(3, 'b'), "bbb");
+  EXPECT_EQ(l.emplace_front("a"), "a");
+  std::string long_string(40, 'c');
+  const char* buffer = long_string.data();
+  l.push_back(std::move(long_string));
+  EXPECT_EQ(l.back().data(), buffer);
+  auto it = l.emplace(l.begin(), 2, 'z');
+  EXPECT_EQ(*it, "zz");
+  l.push_front(std::string("front"));
+  l.insert(l.end(), std::string("back"));
+  EXPECT_EQ(l.size(), 6);
+  EXPECT_EQ(l.front(), "front");
+  EXPECT_EQ(l.back(), "back");
+}
+
+TEST(ListTest, InsertMany) {
+  s21::List<int> l = {1, 5};
+  auto it = l.insert_many(++l.cbegin(), 2, 3, 4);
+  EXPECT_EQ(*it, 2);
+  l.insert_many_back(6, 7);
+  l.insert_many_front(-1, 0);
+  ASSERT_EQ(l.size(), 9);
+  int expected = -1;
+  for (int value : l) EXPECT_EQ(value, expected++);
+  s21::List<int> empty;
+  EXPECT_TRUE(empty.insert_many(empty.cend()) == empty.end());
+}
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <vector>
+
 // Тесты для s21::Map
 TEST(MapTest, Constructor) {
   s21::Map<int, std::string> map;
@@ -119,4 +122,255 @@ TEST(MapTest, Merge) {
   EXPECT_EQ(map1.at(2), "two");
   EXPECT_TRUE(map2.empty());
 }
+
+// Вставка упорядоченных ключей и удаление через одного
+TEST(MapTest, SortedInsertErase) {
+  s21::Map<int, int> map;
+  const int count = 100000;
+  for (int i = 0; i < count; ++i) {
+    EXPECT_TRUE(map.insert(i, i * 2).second);
+  }
+  EXPECT_EQ(map.size(), static_cast<size_t>(count));
+  for (auto it = map.begin(); it != map.end();) {
+    auto current = it++;
+    if (current->first % 2 == 0) map.erase(current);
+  }
+  EXPECT_EQ(map.size(), static_cast<size_t>(count / 2));
+  int expected = 1;
+  for (auto it = map.begin(); it != map.end(); ++it, expected += 2) {
+    EXPECT_EQ(it->first, expected);
+    EXPECT_EQ(it->second, expected * 2);
+  }
+}
+
+// Сравнение с std::map на псевдослучайной последовательности операций
+TEST(MapTest, RandomOperations) {
+  s21::Map<int, int> map;
+  std::map<int, int> reference;
+  unsigned state = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>((state >> 8) % 2000);
+    if (state % 3 == 0) {
+      map.erase(map.find(key));
+      reference.erase(key);
+    } else {
+      map.insert(key, i);
+      reference.insert({key, i});
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  auto expected = reference.begin();
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ(it->first, expected->first);
+    EXPECT_EQ(it->second, expected->second);
+  }
+}
+
+TEST(MapTest, Find) {
+  s21::Map<int, std::string> map{{1, "one"}, {3, "three"}, {5, "five"}};
+  auto it = map.find(3);
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->second, "three");
+  EXPECT_EQ(map.find(4), map.end());
+  const auto& const_map = map;
+  EXPECT_EQ(const_map.find(5)->second, "five");
+  EXPECT_EQ(const_map.find(0), const_map.end());
+}
+
+TEST(MapTest, Bounds) {
+  s21::Map<int, int> map{{10, 1}, {20, 2}, {30, 3}};
+  EXPECT_EQ(map.lower_bound(5)->first, 10);
+  EXPECT_EQ(map.lower_bound(20)->first, 20);
+  EXPECT_EQ(map.lower_bound(25)->first, 30);
+  EXPECT_EQ(map.lower_bound(31), map.end());
+  EXPECT_EQ(map.upper_bound(20)->first, 30);
+  EXPECT_EQ(map.upper_bound(30), map.end());
+  auto range = map.equal_range(20);
+  EXPECT_EQ(range.first->first, 20);
+  EXPECT_EQ(range.second->first, 30);
+  auto missing = map.equal_range(15);
+  EXPECT_EQ(missing.first, missing.second);
+  const auto& const_map = map;
+  EXPECT_EQ(const_map.upper_bound(5)->first, 10);
+}
+// Счетчик копирований и перемещений ключа
+struct CountedKey {
+  static int copies;
+  static int moves;
+  int value;
+  CountedKey(int v = 0) : value(v) {}
+  CountedKey(const CountedKey& other) : value(other.value) { ++copies; }
+  CountedKey(CountedKey&& other) noexcept : value(other.value) { ++moves; }
+  CountedKey& operator=(const CountedKey& other) = default;
+  bool operator<(const CountedKey& other) const { return value < other.value; }
+  static void reset() { copies = moves = 0; }
+};
+int CountedKey::copies = 0;
+int CountedKey::moves = 0;
+
+TEST(MapTest, EmplaceAndTryEmplace) {
+  s21::Map<std::string, std::string> map;
+  auto result = map.emplace("a", "one");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->second, "one");
+  EXPECT_FALSE(map.emplace(std::make_pair(std::string("a"), "x")).second);
+  EXPECT_TRUE(map.emplace(std::piecewise_construct, std::forward_as_tuple("b"),
+                          std::forward_as_tuple(3, 'b'))
+                  .second);
+  EXPECT_EQ(map.at("b"), "bbb");
+
+  std::string value = "two";
+  EXPECT_FALSE(map.try_emplace("a", std::move(value)).second);
+  EXPECT_EQ(value, "two");  // При попадании аргумент не тронут
+  EXPECT_TRUE(map.try_emplace(std::string("c"), std::move(value)).second);
+  EXPECT_EQ(map.at("c"), "two");
+  EXPECT_EQ(map.at("a"), "one");
+  EXPECT_EQ(map.size(), 3);
+}
+
+TEST(MapTest, InsertWithoutExtraCopies) {
+  s21::Map<CountedKey, int> map;
+  CountedKey::reset();
+  map.insert(std::make_pair(CountedKey(1), 1));
+  EXPECT_EQ(CountedKey::copies, 1);  // const Key в паре только копируется
+  s21::Map<CountedKey, int>::value_type duplicate(CountedKey(1), 2);
+  CountedKey::reset();
+  EXPECT_FALSE(map.insert(std::move(duplicate)).second);
+  EXPECT_FALSE(map.try_emplace(CountedKey(1), 3).second);
+  map[CountedKey(1)] = 4;
+  EXPECT_EQ(CountedKey::copies, 0);
+  EXPECT_EQ(CountedKey::moves, 0);
+  map[CountedKey(2)] = 5;
+  map.insert_or_assign(CountedKey(3), 6);
+  EXPECT_EQ(CountedKey::copies, 0);
+  EXPECT_EQ(CountedKey::moves, 2);
+  map.insert_or_assign(CountedKey(3), 7);
+  EXPECT_EQ(map.at(CountedKey(1)), 4);
+  EXPECT_EQ(map.at(CountedKey(3)), 7);
+}
+TEST(MapTest, CopyPreservesStructure) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 1000; ++i) map.insert(i, std::to_string(i));
+  s21::Map<int, std::string> copy(map);
+  map.erase(map.find(10));
+  copy[10] = "ten";
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(map.size(), 999);
+  EXPECT_EQ(copy.at(10), "ten");
+  int expected = 0;
+  for (auto it = copy.begin(); it != copy.end(); ++it, ++expected) {
+    EXPECT_EQ(it->first, expected);
+  }
+  // Копия остается корректным красно-черным деревом
+  for (int i = 0; i < 1000; i += 2) copy.erase(copy.find(i));
+  EXPECT_EQ(copy.size(), 500);
+  EXPECT_EQ(copy.begin()->first, 1);
+
+  s21::Map<int, std::string> assigned{{-1, "x"}};
+  assigned = copy;
+  EXPECT_EQ(assigned.size(), 500);
+  EXPECT_FALSE(assigned.contains(-1));
+}
+
+TEST(MapTest, FromSorted) {
+  for (int count : {0, 1, 2, 3, 7, 8, 100, 4097}) {
+    std::vector<std::pair<int, int>> items;
+    for (int i = 0; i < count; ++i) items.emplace_back(i * 2, i);
+    auto map = s21::Map<int, int>::from_sorted(items.begin(), items.end());
+    ASSERT_EQ(map.size(), static_cast<size_t>(count));
+    int expected = 0;
+    for (auto it = map.begin(); it != map.end(); ++it, expected += 2) {
+      ASSERT_EQ(it->first, expected);
+    }
+    // Балансировка после загрузки работает как обычно
+    for (int i = 0; i < count; ++i) {
+      map.insert(i * 2 + 1, 0);
+      if (i % 3 == 0) map.erase(map.find(i * 2));
+    }
+    expected = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      ASSERT_LT(expected, it->first + 1);
+      expected = it->first + 1;
+    }
+  }
+  using Items = std::vector<std::pair<int, int>>;
+  auto load = [](const Items& items) {
+    return s21::Map<int, int>::from_sorted(items.begin(), items.end());
+  };
+  EXPECT_THROW(load({{1, 1}, {3, 3}, {2, 2}}), std::invalid_argument);
+  EXPECT_THROW(load({{1, 1}, {1, 2}}), std::invalid_argument);
+}
+
+TEST(MapTest, InitializerListUnsorted) {
+  s21::Map<int, int> map{{3, 3}, {1, 1}, {2, 2}, {1, 5}};
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), 1);
+  EXPECT_EQ(map.begin()->first, 1);
+}
+
+TEST(MapTest, MergeKeepsDuplicates) {
+  s21::Map<int, std::string> target{{1, "a1"}, {3, "a3"}};
+  s21::Map<int, std::string> source{{1, "b1"}, {2, "b2"}, {4, "b4"}};
+  const std::string* address = &source.at(2);
+  target.merge(source);
+  EXPECT_EQ(target.size(), 4);
+  EXPECT_EQ(target.at(1), "a1");
+  EXPECT_EQ(&target.at(2), address);  // Узел перенесен, а не скопирован
+  ASSERT_EQ(source.size(), 1);
+  EXPECT_EQ(source.at(1), "b1");
+  target.merge(target);
+  EXPECT_EQ(target.size(), 4);
+}
+
+TEST(MapTest, MergeLarge) {
+  s21::Map<int, int> target;
+  s21::Map<int, int> source;
+  for (int i = 0; i < 10000; ++i) {
+    if (i % 2 == 0) target.insert(i, 0);
+    if (i % 3 == 0) source.insert(i, 1);
+  }
+  target.merge(source);
+  EXPECT_EQ(source.size(), 1667u);  // Кратные 6
+  for (auto it = source.begin(); it != source.end(); ++it) {
+    EXPECT_EQ(it->first % 6, 0);
+  }
+  int expected = 0;
+  for (auto it = target.begin(); it != target.end(); ++it) {
+    while (expected % 2 != 0 && expected % 3 != 0) ++expected;
+    EXPECT_EQ(it->first, expected++);
+  }
+  for (int i = 0; i < 10000; i += 5) target.erase(target.find(i));
+  EXPECT_FALSE(target.contains(0));
+}
+
+TEST(MapTest, ExtractInsertNode) {
+  s21::Map<int, std::string> map{{1, "one"}, {2, "two"}, {3, "three"}};
+  auto node = map.extract(2);
+  ASSERT_TRUE(node);
+  EXPECT_EQ(node.key(), 2);
+  EXPECT_EQ(node.mapped(), "two");
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_TRUE(map.extract(5).empty());
+
+  node.mapped() = "deux";
+  s21::Map<int, std::string> other{{2, "zwei"}};
+  auto rejected = other.insert(std::move(node));
+  EXPECT_FALSE(rejected.inserted);
+  EXPECT_EQ(rejected.position->second, "zwei");
+  ASSERT_FALSE(rejected.node.empty());
+
+  auto result = map.insert(std::move(rejected.node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(result.position->second, "deux");
+  EXPECT_EQ(map.size(), 3);
+
+  auto dropped = map.extract(map.begin());
+  EXPECT_EQ(dropped.key(), 1);
+  EXPECT_EQ(map.begin()->first, 2);
+  EXPECT_FALSE(map.insert(s21::Map<int, std::string>::node_type()).inserted);
+}
+
 // Добавьте остальные тесты для s21::Map
@@ -0,0 +1,120 @@
+#include "../s21_mapped_vector.h"
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+
+// Fresh file under the gtest temp directory, removed at the end of a test
+class MappedVectorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "s21_mapped_vector_" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::remove(path_.c_str());
+  }
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  long FileSize() const {
+    struct stat info;
+    return ::stat(path_.c_str(), &info) == 0 ? info.st_size : -1;
+  }
+
+  std::string path_;
+};
+
+struct Point {
+  int x;
+  double y;
+};
+
+TEST_F(MappedVectorTest, PersistsAcrossReopen) {
+  {
+    s21::MappedVector<int> vec(path_);
+    EXPECT_TRUE(vec.empty());
+    for (int i = 0; i < 10000; ++i) vec.push_back(i);
+    EXPECT_GE(vec.capacity(), 10000);
+    EXPECT_EQ(FileSize(), static_cast<long>(vec.capacity() * sizeof(int)));
+    vec.sync();
+  }
+  EXPECT_EQ(FileSize(), static_cast<long>(10000 * sizeof(int)));
+  s21::MappedVector<int> vec(path_);
+  ASSERT_EQ(vec.size(), 10000);
+  EXPECT_EQ(vec.capacity(), 10000);
+  for (int i = 0; i < 10000; ++i) ASSERT_EQ(vec[i], i);
+  EXPECT_EQ(vec.back(), 9999);
+  EXPECT_THROW(vec.at(10000), std::out_of_range);
+}
+
+TEST_F(MappedVectorTest, InsertEraseResize) {
+  s21::MappedVector<Point> vec(path_);
+  vec.emplace_back(Point{1, 1.5});
+  vec.push_back({3, 3.5});
+  vec.insert(vec.begin() + 1, {2, 2.5});
+  vec.insert(vec.begin(), vec[2]);
+  ASSERT_EQ(vec.size(), 4);
+  EXPECT_EQ(vec[0].x, 3);
+  EXPECT_EQ(vec[2].y, 2.5);
+  vec.erase(vec.begin());
+  EXPECT_EQ(vec.erase(vec.begin(), vec.begin() + 2), vec.begin());
+  EXPECT_EQ(vec.front().x, 3);
+  vec.resize(100);
+  EXPECT_EQ(vec[99].x, 0);
+  vec.resize(1);
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.capacity(), 1);
+  EXPECT_EQ(FileSize(), static_cast<long>(sizeof(Point)));
+  vec.pop_back();
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.capacity(), 0);
+  vec.push_back({4, 4.5});
+  EXPECT_EQ(vec.at(0).x, 4);
+}
+
+TEST_F(MappedVectorTest, AlgorithmsAndHints) {
+  s21::MappedVector<long> vec(path_);
+  vec.advise(s21::AccessPattern::kSequential);
+  vec.reserve(1 << 16);
+  for (long i = 0; i < (1 << 16); ++i) vec.push_back((i * 7919) % 65536);
+  vec.advise(s21::AccessPattern::kRandom);
+  std::sort(vec.begin(), vec.end());
+  EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  vec.flush_range(0, 0);
+  vec.flush_range(1000, 5000);
+  vec.flush_range(0, vec.size());
+  EXPECT_THROW(vec.flush_range(1, vec.size()), std::out_of_range);
+  vec.advise(s21::AccessPattern::kWillNeed);
+  vec.advise(s21::AccessPattern::kNormal);
+  EXPECT_EQ(vec[12345], 12345);
+}
+
+TEST_F(MappedVectorTest, MoveAndSwap) {
+  s21::MappedVector<int> vec(path_);
+  vec.push_back(7);
+  s21::MappedVector<int> moved(std::move(vec));
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(moved[0], 7);
+  const std::string other_path = path_ + "_other";
+  {
+    s21::MappedVector<int> other(other_path);
+    other.push_back(1);
+    other.push_back(2);
+    other.swap(moved);
+    EXPECT_EQ(other.size(), 1);
+    EXPECT_EQ(moved.size(), 2);
+    moved = std::move(other);
+    EXPECT_EQ(moved.size(), 1);
+  }
+  std::remove(other_path.c_str());
+}
+
+TEST_F(MappedVectorTest, RejectsPartialElement) {
+  std::ofstream(path_) << "12345";
+  EXPECT_THROW(s21::MappedVector<int> vec(path_), std::runtime_error);
+  EXPECT_THROW(s21::MappedVector<int> vec("/nonexistent/dir/file"),
+               std::system_error);
+}
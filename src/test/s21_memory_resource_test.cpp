@@ -0,0 +1,282 @@
+#include "../s21_memory_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <type_traits>
+
+#include "../s21_deque.h"
+#include "../s21_list.h"
+#include "../s21_map.h"
+#include "../s21_queue.h"
+#include "../s21_set.h"
+#include "../s21_stack.h"
+#include "../s21_vector.h"
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+// Counts upstream traffic to check what the resources pass through
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* ptr, std::size_t bytes,
+                     std::size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(ArenaResourceTest, BumpAllocationAndAlignment) {
+  CountingResource upstream;
+  s21::ArenaResource arena(1024, &upstream);
+  void* a = arena.allocate(3, 1);
+  void* b = arena.allocate(8, 8);
+  void* c = arena.allocate(16, 64);
+  ASSERT_TRUE(IsAligned(b, 8));
+  ASSERT_TRUE(IsAligned(c, 64));
+  ASSERT_LT(static_cast<char*>(a), static_cast<char*>(b));
+  ASSERT_LT(static_cast<char*>(b), static_cast<char*>(c));
+  arena.deallocate(b, 8, 8);  // No-op
+  ASSERT_EQ(upstream.allocations, 1);
+  ASSERT_EQ(arena.bytes_in_use(), 27);
+  // Larger than a block: a block of its own
+  static_cast<void>(arena.allocate(10000, 16));
+  ASSERT_EQ(upstream.allocations, 2);
+}
+
+TEST(ArenaResourceTest, ResetKeepsNewestBlock) {
+  CountingResource upstream;
+  {
+    s21::ArenaResource arena(256, &upstream);
+    for (int i = 0; i < 100; ++i) static_cast<void>(arena.allocate(64, 8));
+    const std::size_t blocks = upstream.allocations;
+    ASSERT_GT(blocks, 1);
+    arena.reset();
+    ASSERT_EQ(upstream.deallocations, blocks - 1);
+    ASSERT_EQ(arena.bytes_in_use(), 0);
+    // The kept block is the largest one, refilling it needs no upstream
+    for (int i = 0; i < 10; ++i) static_cast<void>(arena.allocate(64, 8));
+    ASSERT_EQ(upstream.allocations, blocks);
+    arena.release();
+    ASSERT_EQ(upstream.deallocations, upstream.allocations);
+  }
+  ASSERT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(ArenaResourceTest, InitialBuffer) {
+  CountingResource upstream;
+  alignas(16) char buffer[512];
+  s21::ArenaResource arena(buffer, sizeof(buffer), &upstream);
+  void* first = arena.allocate(100, 16);
+  ASSERT_EQ(first, buffer);
+  static_cast<void>(arena.allocate(400, 8));
+  ASSERT_EQ(upstream.allocations, 0);
+  static_cast<void>(arena.allocate(100, 8));
+  ASSERT_EQ(upstream.allocations, 1);
+  arena.release();
+  ASSERT_EQ(arena.allocate(8, 8), buffer);
+}
+
+TEST(PoolResourceTest, RecyclesBlocksBySizeClass) {
+  CountingResource upstream;
+  s21::PoolResource pool(&upstream);
+  void* a = pool.allocate(24, 8);
+  void* b = pool.allocate(24, 8);
+  ASSERT_NE(a, b);
+  ASSERT_TRUE(IsAligned(a, 8));
+  ASSERT_EQ(upstream.allocations, 1);
+  pool.deallocate(a, 24, 8);
+  // 17..32 bytes share a class, so the freed block comes back
+  ASSERT_EQ(pool.allocate(32, 16), a);
+  void* other_class = pool.allocate(100, 8);
+  ASSERT_EQ(upstream.allocations, 2);
+  pool.deallocate(other_class, 100, 8);
+  pool.deallocate(b, 24, 8);
+  pool.deallocate(a, 32, 16);
+  ASSERT_EQ(upstream.deallocations, 0);
+  pool.release();
+  ASSERT_EQ(upstream.deallocations, 2);
+}
+
+TEST(PoolResourceTest, LargeAndOveralignedGoUpstream) {
+  CountingResource upstream;
+  s21::PoolResource pool(&upstream);
+  void* large = pool.allocate(s21::PoolResource::kMaxBlock + 1, 8);
+  void* aligned = pool.allocate(64, 128);
+  ASSERT_TRUE(IsAligned(aligned, 128));
+  ASSERT_EQ(upstream.allocations, 2);
+  pool.deallocate(large, s21::PoolResource::kMaxBlock + 1, 8);
+  pool.deallocate(aligned, 64, 128);
+  ASSERT_EQ(upstream.deallocations, 2);
+}
+
+TEST(PoolResourceTest, ChunksGrowAndBlocksStayDistinct) {
+  s21::PoolResource pool;
+  std::set<void*> seen;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(seen.insert(pool.allocate(48, 16)).second);
+  }
+  // 16 + 32 + 64 + ... blocks per chunk
+  ASSERT_LT(pool.stats().system_allocations, 8);
+}
+
+TEST(PmrContainersTest, VectorAndDequeUseResource) {
+  s21::ArenaResource arena;
+  s21::pmr::Vector<int> v(&arena);
+  s21::pmr::Deque<std::string> d(&arena);
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(i);
+    d.push_back(std::to_string(i));
+  }
+  ASSERT_EQ(v.get_allocator().resource(), &arena);
+  ASSERT_EQ(d.get_allocator().resource(), &arena);
+  ASSERT_EQ(v[99], 99);
+  ASSERT_EQ(d.back(), "99");
+  ASSERT_GT(arena.stats().node_allocations, 0);
+  // Copies take the default resource, as std::pmr containers do
+  s21::pmr::Vector<int> copy(v);
+  ASSERT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+  s21::pmr::Vector<int> on_arena(v, &arena);
+  ASSERT_EQ(on_arena.get_allocator().resource(), &arena);
+  ASSERT_EQ(on_arena[50], 50);
+}
+
+TEST(PmrContainersTest, MoveBetweenResources) {
+  s21::ArenaResource first;
+  s21::PoolResource second;
+  s21::pmr::Vector<std::string> a({"x", "y", "z"}, &first);
+  s21::pmr::Vector<std::string> b(&second);
+  b = std::move(a);  // Different resources: elements move, b keeps its own
+  ASSERT_EQ(b.get_allocator().resource(), &second);
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b[2], "z");
+  ASSERT_EQ(a.size(), 0);
+  s21::pmr::Deque<int> c({1, 2, 3}, &first);
+  s21::pmr::Deque<int> d(std::move(c), &second);
+  ASSERT_EQ(d.get_allocator().resource(), &second);
+  ASSERT_EQ(d.size(), 3);
+  ASSERT_EQ(d.front(), 1);
+}
+
+TEST(PmrContainersTest, ListNodesFromResource) {
+  s21::ArenaResource arena;
+  s21::pmr::List<std::string> l(&arena);
+  for (int i = 0; i < 50; ++i) l.push_back(std::to_string(i));
+  ASSERT_EQ(l.get_allocator().resource(), &arena);
+  ASSERT_EQ(arena.stats().node_allocations, 50);
+  s21::pmr::List<std::string> other(&arena);
+  other.push_back("tail");
+  l.splice(l.cend(), other);
+  ASSERT_EQ(l.size(), 51);
+  ASSERT_EQ(l.back(), "tail");
+  l.pop_front();
+  ASSERT_EQ(arena.stats().node_deallocations, 1);
+}
+
+TEST(PmrContainersTest, MapAndSetUseResource) {
+  s21::ArenaResource arena;
+  {
+    s21::pmr::Map<int, std::string> m(&arena);
+    for (int i = 0; i < 100; ++i) m.insert(i, std::to_string(i));
+    ASSERT_EQ(m.get_allocator().resource(), &arena);
+    ASSERT_EQ(arena.stats().node_allocations, 100);
+    ASSERT_EQ(m.at(42), "42");
+    s21::pmr::Map<int, std::string> copy(m, &arena);
+    ASSERT_EQ(copy.size(), 100);
+    ASSERT_EQ(copy.at(99), "99");
+    auto node = copy.extract(7);
+    ASSERT_EQ(node.get_allocator().resource(), &arena);
+    ASSERT_TRUE(m.insert(std::move(node)).position != m.end());
+
+    s21::pmr::Set<int> s({3, 1, 2}, &arena);
+    ASSERT_EQ(s.get_allocator().resource(), &arena);
+    ASSERT_TRUE(s.contains(2));
+  }
+  // Every node went back to the arena before its reset
+  ASSERT_EQ(arena.stats().node_deallocations, arena.stats().node_allocations);
+  arena.reset();
+}
+
+TEST(PmrContainersTest, MergeAcrossResourcesCopiesNodes) {
+  s21::ArenaResource first;
+  s21::PoolResource second;
+  s21::pmr::Map<int, int> a({{1, 1}, {3, 3}}, &first);
+  s21::pmr::Map<int, int> b({{2, 2}, {3, 30}}, &second);
+  a.merge(b);
+  ASSERT_EQ(a.size(), 3);
+  ASSERT_EQ(a.at(2), 2);
+  ASSERT_EQ(b.size(), 1);
+  ASSERT_EQ(b.at(3), 30);
+  ASSERT_EQ(second.stats().node_deallocations, 1);
+  a = std::move(b);
+  ASSERT_EQ(a.get_allocator().resource(), &first);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(a.at(3), 30);
+}
+
+// Across resources the nodes are copied into this set's resource, so a
+// failing allocation must reach the caller instead of terminating
+TEST(PmrContainersTest, SetMoveAssignAcrossResourcesThrows) {
+  s21::ArenaResource arena;
+  s21::pmr::Set<int> source({1, 2, 3}, &arena);
+  s21::pmr::Set<int> target(std::pmr::null_memory_resource());
+  ASSERT_FALSE(std::is_nothrow_move_assignable<s21::pmr::Set<int>>::value);
+  ASSERT_THROW(target = std::move(source), std::bad_alloc);
+  ASSERT_TRUE(target.empty());
+  s21::pmr::Set<int> other({4}, &arena);
+  other = std::move(source);
+  ASSERT_TRUE(other.contains(3));
+}
+
+// Copying overloads allocate a node too: a failure must reach the caller
+TEST(PmrContainersTest, ListCopyInsertPropagatesBadAlloc) {
+  s21::pmr::List<int> l(std::pmr::null_memory_resource());
+  const int value = 1;
+  ASSERT_THROW(l.push_back(value), std::bad_alloc);
+  ASSERT_THROW(l.push_front(value), std::bad_alloc);
+  ASSERT_THROW(l.insert(l.begin(), value), std::bad_alloc);
+  ASSERT_THROW(l.assign({1, 2}), std::bad_alloc);
+  ASSERT_TRUE(l.empty());
+  s21::Stack<int, s21::pmr::List<int>> s(std::pmr::null_memory_resource());
+  ASSERT_THROW(s.push(value), std::bad_alloc);
+  s21::Queue<int, s21::pmr::List<int>> q(std::pmr::null_memory_resource());
+  ASSERT_THROW(q.push(value), std::bad_alloc);
+}
+
+TEST(PmrContainersTest, AdaptersForwardResource) {
+  s21::ArenaResource arena;
+  s21::pmr::Stack<int> s(&arena);
+  s21::pmr::Queue<int> q(&arena);
+  s21::Stack<int, s21::pmr::List<int>> list_stack(&arena);
+  for (int i = 0; i < 10; ++i) {
+    s.push(i);
+    q.push(i);
+    list_stack.push(i);
+  }
+  ASSERT_EQ(s.top(), 9);
+  ASSERT_EQ(q.front(), 0);
+  ASSERT_EQ(list_stack.size(), 10);
+  ASSERT_FALSE((std::is_constructible<s21::Stack<int>,
+                                      std::pmr::memory_resource*>::value));
+  s21::pmr::Stack<int> moved(std::move(s));
+  ASSERT_EQ(moved.top(), 9);
+}
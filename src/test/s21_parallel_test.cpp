@@ -0,0 +1,150 @@
+#include "../s21_parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_vector.h"
+
+namespace {
+
+// Several chunks and several merge levels
+constexpr std::size_t kSize = 200003;
+
+s21::Vector<int> RandomInts(std::size_t n, int range) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> dist(-range, range);
+  s21::Vector<int> v(n);
+  for (auto& x : v) x = dist(rng);
+  return v;
+}
+
+}  // namespace
+
+TEST(ParallelTest, SortMatchesStdSort) {
+  s21::ThreadPool pool(4);
+  s21::Vector<int> v = RandomInts(kSize, 1000);
+  s21::Vector<int> expected = v;
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::sort(pool, v.begin(), v.end());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  s21::parallel::sort(pool, v.begin(), v.end(), std::greater<>());
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+  // Below the cutoff the input stays on the calling thread
+  s21::Vector<int> small{3, 1, 2};
+  s21::parallel::sort(pool, small.begin(), small.end());
+  ASSERT_EQ(small[0], 1);
+  ASSERT_EQ(small[2], 3);
+}
+
+TEST(ParallelTest, SortMovesStrings) {
+  s21::ThreadPool pool(3);
+  s21::Vector<int> keys = RandomInts(50000, 1 << 20);
+  s21::Vector<std::string> v(keys.size());
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    v[i] = "value-with-heap-storage-" + std::to_string(keys[i]);
+  }
+  s21::Vector<std::string> expected = v;
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::sort(pool, v.begin(), v.end());
+  ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST(ParallelTest, ForEachAndTransform) {
+  s21::ThreadPool pool(4);
+  s21::Vector<int> v(kSize);
+  std::iota(v.begin(), v.end(), 0);
+  s21::parallel::for_each(pool, v.begin(), v.end(), [](int& x) { x *= 2; });
+  ASSERT_EQ(v[kSize - 1], 2 * static_cast<int>(kSize - 1));
+  s21::Vector<long long> squares(kSize);
+  auto end = s21::parallel::transform(
+      pool, v.begin(), v.end(), squares.begin(),
+      [](int x) { return static_cast<long long>(x) * x; });
+  ASSERT_EQ(end, squares.end());
+  ASSERT_EQ(squares[1000], 4000000);
+  s21::parallel::transform(pool, v.begin(), v.end(), squares.begin(),
+                           squares.begin(),
+                           [](int x, long long y) { return y - x; });
+  ASSERT_EQ(squares[3], 36 - 6);
+  s21::Vector<int> empty;
+  s21::parallel::for_each(pool, empty.begin(), empty.end(),
+                          [](int&) { FAIL(); });
+}
+
+TEST(ParallelTest, ReduceIsDeterministic) {
+  s21::Vector<double> v(kSize);
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  for (auto& x : v) x = dist(rng);
+  s21::ThreadPool one(1);
+  s21::ThreadPool four(4);
+  const double a = s21::parallel::reduce(one, v.begin(), v.end());
+  const double b = s21::parallel::reduce(four, v.begin(), v.end());
+  ASSERT_EQ(a, b);  // Same grouping, bit for bit
+  ASSERT_NEAR(a, std::accumulate(v.begin(), v.end(), 0.0), 1e-3);
+  // Associative but not commutative: concatenation order must hold
+  s21::Vector<std::string> letters(40000);
+  std::string expected = ">";
+  for (std::size_t i = 0; i < letters.size(); ++i) {
+    letters[i] = std::string(1, static_cast<char>('a' + i % 26));
+    expected += letters[i];
+  }
+  const std::string joined = s21::parallel::reduce(
+      four, letters.begin(), letters.end(), std::string(">"), std::plus<>());
+  ASSERT_EQ(joined, expected);
+}
+
+TEST(ParallelTest, InclusiveScan) {
+  s21::ThreadPool pool(4);
+  s21::Vector<long long> v(kSize);
+  std::iota(v.begin(), v.end(), 1);
+  s21::Vector<long long> out(kSize);
+  s21::parallel::inclusive_scan(pool, v.begin(), v.end(), out.begin());
+  for (std::size_t i = 0; i < kSize; i += 997) {
+    ASSERT_EQ(out[i], static_cast<long long>((i + 1) * (i + 2) / 2));
+  }
+  ASSERT_EQ(out[kSize - 1], static_cast<long long>(kSize * (kSize + 1) / 2));
+  // In place, with another operation
+  s21::Vector<int> w = RandomInts(kSize, 1000000);
+  s21::Vector<int> expected(kSize);
+  auto max = [](int x, int y) { return std::max(x, y); };
+  std::inclusive_scan(w.begin(), w.end(), expected.begin(), max);
+  s21::parallel::inclusive_scan(pool, w.begin(), w.end(), w.begin(), max);
+  ASSERT_TRUE(std::equal(w.begin(), w.end(), expected.begin()));
+}
+
+TEST(ParallelTest, Partition) {
+  s21::ThreadPool pool(4);
+  for (int range : {1, 10, 1000}) {
+    s21::Vector<int> v = RandomInts(kSize, range);
+    const long long sum = std::accumulate(v.begin(), v.end(), 0LL);
+    const auto negative = [](int x) { return x < 0; };
+    const auto count = std::count_if(v.begin(), v.end(), negative);
+    auto middle = s21::parallel::partition(pool, v.begin(), v.end(), negative);
+    ASSERT_EQ(middle - v.begin(), count);
+    ASSERT_TRUE(std::is_partitioned(v.begin(), v.end(), negative));
+    ASSERT_EQ(std::accumulate(v.begin(), v.end(), 0LL), sum);
+  }
+  s21::Vector<int> all_true(kSize);
+  std::fill(all_true.begin(), all_true.end(), 1);
+  auto end = s21::parallel::partition(pool, all_true.begin(), all_true.end(),
+                                      [](int x) { return x > 0; });
+  ASSERT_EQ(end, all_true.end());
+}
+
+TEST(ParallelTest, DefaultPoolAndExceptions) {
+  s21::Vector<int> v = RandomInts(kSize, 100);
+  s21::parallel::sort(v.begin(), v.end());
+  ASSERT_TRUE(std::is_sorted(v.begin(), v.end()));
+  ASSERT_EQ(s21::parallel::reduce(v.begin(), v.end()),
+            std::accumulate(v.begin(), v.end(), 0));
+  auto throw_at_max = [](int x) {
+    if (x == 100) throw std::runtime_error("stop");
+  };
+  ASSERT_THROW(s21::parallel::for_each(v.begin(), v.end(), throw_at_max),
+               std::runtime_error);
+}
@@ -0,0 +1,181 @@
+#include "../s21_priority_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_vector.h"
+
+namespace {
+
+template <class Queue>
+std::vector<int> Drain(Queue& q) {
+  std::vector<int> out;
+  while (!q.empty()) {
+    out.push_back(q.top());
+    q.pop();
+  }
+  return out;
+}
+
+template <std::size_t Arity>
+void CheckAgainstStd() {
+  std::mt19937 rng(Arity);
+  std::uniform_int_distribution<int> dist(0, 500);
+  s21::PriorityQueue<int, std::less<int>, s21::Vector<int>, Arity> q;
+  std::priority_queue<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    if (dist(rng) % 3 == 0 && !expected.empty()) {
+      ASSERT_EQ(q.top(), expected.top());
+      q.pop();
+      expected.pop();
+    } else {
+      const int value = dist(rng);
+      q.push(value);
+      expected.push(value);
+    }
+  }
+  ASSERT_EQ(q.size(), expected.size());
+  while (!expected.empty()) {
+    ASSERT_EQ(q.top(), expected.top());
+    q.pop();
+    expected.pop();
+  }
+}
+
+}  // namespace
+
+TEST(PriorityQueueTest, MatchesStdPriorityQueue) {
+  CheckAgainstStd<2>();
+  CheckAgainstStd<4>();
+  CheckAgainstStd<8>();
+}
+
+TEST(PriorityQueueTest, EmptyThrows) {
+  s21::PriorityQueue<int> q;
+  ASSERT_TRUE(q.empty());
+  ASSERT_THROW(q.top(), std::runtime_error);
+  ASSERT_THROW(q.pop(), std::runtime_error);
+}
+
+TEST(PriorityQueueTest, BulkConstruction) {
+  s21::Vector<int> items{5, 1, 9, 3, 7, 2, 8};
+  s21::PriorityQueue<int> from_container(std::less<int>(), std::move(items));
+  ASSERT_EQ(Drain(from_container), (std::vector<int>{9, 8, 7, 5, 3, 2, 1}));
+  std::vector<int> range{4, 6, 2};
+  s21::PriorityQueue<int, std::greater<int>> min_queue(range.begin(),
+                                                      range.end());
+  ASSERT_EQ(Drain(min_queue), (std::vector<int>{2, 4, 6}));
+  s21::PriorityQueue<int> init{3, 1, 2};
+  ASSERT_EQ(init.top(), 3);
+}
+
+TEST(PriorityQueueTest, PushManyAndTopK) {
+  s21::PriorityQueue<int, std::less<int>, s21::Vector<int>, 8> q{50, 40};
+  std::vector<int> small{45};
+  q.push_many(small.begin(), small.end());  // Sifted in
+  std::vector<int> large(1000);
+  for (int i = 0; i < 1000; ++i) large[i] = (i * 37) % 1000;
+  q.push_many(large.begin(), large.end());  // Rebuilt
+  ASSERT_EQ(q.size(), 1003);
+  std::vector<int> top(5);
+  auto end = q.pop_top_k(5, top.begin());
+  ASSERT_EQ(end, top.end());
+  ASSERT_EQ(top, (std::vector<int>{999, 998, 997, 996, 995}));
+  std::vector<int> rest;
+  q.pop_top_k(2000, std::back_inserter(rest));
+  ASSERT_EQ(rest.size(), 998);
+  ASSERT_TRUE(std::is_sorted(rest.rbegin(), rest.rend()));
+  ASSERT_TRUE(q.empty());
+}
+
+TEST(PriorityQueueTest, MoveOnlyFriendlyTypesAndSwap) {
+  s21::PriorityQueue<std::string> a;
+  a.push(std::string("pear"));
+  a.push("apple");
+  s21::PriorityQueue<std::string> b{"zebra"};
+  a.swap(b);
+  ASSERT_EQ(a.top(), "zebra");
+  ASSERT_EQ(b.top(), "pear");
+  ASSERT_EQ(b.size(), 2);
+}
+
+TEST(IndexedPriorityQueueTest, DecreaseKeyAndErase) {
+  s21::IndexedPriorityQueue<int> q(4);
+  q.push(0, 50);
+  q.push(1, 20);
+  q.push(2, 30);
+  q.push(7, 40);  // Grows the id table
+  ASSERT_THROW(q.push(1, 5), std::invalid_argument);
+  ASSERT_EQ(q.top(), 1);
+  ASSERT_EQ(q.top_priority(), 20);
+  q.decrease_key(0, 10);
+  ASSERT_EQ(q.top(), 0);
+  ASSERT_THROW(q.decrease_key(2, 35), std::invalid_argument);
+  ASSERT_THROW(q.decrease_key(5, 1), std::invalid_argument);
+  q.update(0, 100);  // Moves down
+  ASSERT_EQ(q.top(), 1);
+  ASSERT_TRUE(q.erase(2));
+  ASSERT_FALSE(q.erase(2));
+  ASSERT_FALSE(q.contains(2));
+  ASSERT_EQ(q.priority(7), 40);
+  std::vector<int> order;
+  while (!q.empty()) {
+    order.push_back(static_cast<int>(q.top()));
+    q.pop();
+  }
+  ASSERT_EQ(order, (std::vector<int>{1, 7, 0}));
+  ASSERT_THROW(q.pop(), std::runtime_error);
+}
+
+// Dijkstra on a random graph against a lazy-deletion std::priority_queue
+TEST(IndexedPriorityQueueTest, Dijkstra) {
+  constexpr int kNodes = 500;
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int> node(0, kNodes - 1);
+  std::uniform_int_distribution<int> weight(1, 100);
+  std::vector<std::vector<std::pair<int, int>>> edges(kNodes);
+  for (int i = 0; i < kNodes * 6; ++i) {
+    edges[node(rng)].emplace_back(node(rng), weight(rng));
+  }
+  constexpr long long kInf = std::numeric_limits<long long>::max();
+
+  std::vector<long long> expected(kNodes, kInf);
+  using Item = std::pair<long long, int>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> lazy;
+  expected[0] = 0;
+  lazy.emplace(0, 0);
+  while (!lazy.empty()) {
+    auto [d, u] = lazy.top();
+    lazy.pop();
+    if (d != expected[u]) continue;
+    for (auto [v, w] : edges[u]) {
+      if (d + w < expected[v]) lazy.emplace(expected[v] = d + w, v);
+    }
+  }
+
+  std::vector<long long> dist(kNodes, kInf);
+  s21::IndexedPriorityQueue<long long, std::greater<long long>, 2> q(kNodes);
+  dist[0] = 0;
+  q.push(0, 0);
+  while (!q.empty()) {
+    const std::size_t u = q.top();
+    q.pop();
+    for (auto [v, w] : edges[u]) {
+      if (dist[u] + w >= dist[v]) continue;
+      dist[v] = dist[u] + w;
+      if (q.contains(v)) {
+        q.decrease_key(v, dist[v]);
+      } else {
+        q.push(v, dist[v]);
+      }
+    }
+  }
+  ASSERT_EQ(dist, expected);
+}
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <utility>
+
 TEST(QueueTest, Constructors) {
   size_t count = 0;
   s21::Queue<int> q1, q2{0, 1, 2, 3, 4, 5}, q3(q2);
@@ -73,3 +76,56 @@ TEST(QueueTest, QueueModifiers) {
     count++;
   }
 }
+
+TEST(QueueTest, ListContainer) {
+  s21::Queue<int, s21::List<int>> q{1, 2, 3};
+  q.push(4);
+  q.pop();
+  ASSERT_EQ(q.front(), 2);
+  ASSERT_EQ(q.back(), 4);
+  ASSERT_EQ(q.size(), 3);
+}
+
+TEST(QueueTest, RingBufferWrap) {
+  s21::Queue<int> q;
+  int pushed = 0, popped = 0;
+  for (int round = 0; round < 1000; ++round) {
+    for (int i = 0; i < 7; ++i) q.push(pushed++);
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_EQ(q.front(), popped++);
+      q.pop();
+    }
+  }
+  ASSERT_EQ(q.size(), static_cast<size_t>(pushed - popped));
+  ASSERT_EQ(q.back(), pushed - 1);
+}
+
+template <class QueueType>
+void CheckQueueEmplace() {
+  QueueType q;
+  q.emplace(3, 'a');
+  std::string long_string(40, 'b');
+  q.push(std::move(long_string));
+  q.insert_many_back("c", std::string("d"));
+  ASSERT_EQ(q.size(), 4);
+  ASSERT_EQ(q.front(), "aaa");
+  ASSERT_EQ(q.back(), "d");
+  q.pop();
+  ASSERT_EQ(q.front(), std::string(40, 'b'));
+  q.pop();
+  ASSERT_EQ(q.front(), "c");
+}
+
+TEST(QueueTest, EmplaceAndMove) {
+  CheckQueueEmplace<s21::Queue<std::string>>();
+  CheckQueueEmplace<s21::Queue<std::string, s21::List<std::string>>>();
+}
+
+TEST(QueueTest, EmptyThrows) {
+  s21::Queue<int> q;
+  ASSERT_THROW(q.front(), std::runtime_error);
+  ASSERT_THROW(q.pop(), std::runtime_error);
+  s21::Queue<int, s21::List<int>> list_queue;
+  ASSERT_THROW(list_queue.back(), std::runtime_error);
+  ASSERT_THROW(list_queue.pop(), std::runtime_error);
+}
@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <string>
 #include <utility>
+#include <vector>
 
 // Тесты для s21::Set
 TEST(SetTest, DefaultConstructor) {
@@ -140,7 +143,9 @@ TEST(SetTest, Merge) {
   EXPECT_TRUE(set1.contains(1));
   EXPECT_TRUE(set1.contains(2));
   EXPECT_TRUE(set1.contains(3));
-  EXPECT_TRUE(set2.empty());
+  // Повторяющийся элемент остается в исходном множестве
+  EXPECT_EQ(set2.size(), 1);
+  EXPECT_TRUE(set2.contains(2));
 }
 
 template <typename Key, typename T>
@@ -164,3 +169,109 @@ TEST(SetTest, Contains) {
   EXPECT_TRUE(set.contains(2));
   EXPECT_FALSE(set.contains(4));
 }
+
+TEST(SetTest, FindLarge) {
+  s21::Set<int> set;
+  for (int i = 0; i < 100000; ++i) set.insert(i * 2);
+  for (int i = 0; i < 100000; ++i) {
+    EXPECT_TRUE(set.contains(i * 2));
+    EXPECT_FALSE(set.contains(i * 2 + 1));
+  }
+  EXPECT_EQ(set.find(-1), set.end());
+  EXPECT_EQ(set.find(500)->first, 500);
+}
+
+TEST(SetTest, EmplaceAndMoveInsert) {
+  s21::Set<std::string> set;
+  std::string value(40, 'x');
+  EXPECT_TRUE(set.insert(std::move(value)).second);
+  EXPECT_TRUE(set.emplace(3, 'y').second);
+  EXPECT_FALSE(set.emplace("yyy").second);
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains(std::string(40, 'x')));
+}
+
+TEST(SetTest, ExtractInsertNode) {
+  s21::Set<std::string> set = {"a", "b", "c"};
+  auto node = set.extract("b");
+  ASSERT_FALSE(node.empty());
+  EXPECT_EQ(node.key(), "b");
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.extract("x").empty());
+  s21::Set<std::string> other;
+  auto result = other.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(result.position->first, "b");
+  EXPECT_TRUE(node.empty());
+}
+
+static std::vector<int> Keys(s21::Set<int> set) {
+  std::vector<int> keys;
+  for (auto it = set.begin(); it != set.end(); ++it) keys.push_back(it->first);
+  return keys;
+}
+
+TEST(SetTest, SetAlgebra) {
+  s21::Set<int> a = {1, 3, 5, 7, 9, 11};
+  s21::Set<int> b = {0, 3, 4, 9, 12};
+  s21::Set<int> u = a.set_union(b);
+  s21::Set<int> i = a.set_intersection(b);
+  s21::Set<int> d = a.set_difference(b);
+  s21::Set<int> s = a.set_symmetric_difference(b);
+  EXPECT_EQ(Keys(u), (std::vector<int>{0, 1, 3, 4, 5, 7, 9, 11, 12}));
+  EXPECT_EQ(Keys(i), (std::vector<int>{3, 9}));
+  EXPECT_EQ(Keys(d), (std::vector<int>{1, 5, 7, 11}));
+  EXPECT_EQ(Keys(s), (std::vector<int>{0, 1, 4, 5, 7, 11, 12}));
+  EXPECT_EQ(u.size(), 9);
+  EXPECT_TRUE(u.contains(12));
+  EXPECT_TRUE(u.insert(6).second);
+  EXPECT_EQ(a.size(), 6);
+  EXPECT_EQ(b.size(), 5);
+  s21::Set<int> empty;
+  EXPECT_TRUE(a.set_intersection(empty).empty());
+  EXPECT_EQ(Keys(empty.set_union(a)), Keys(a));
+  EXPECT_EQ(Keys(a.set_difference(empty)), Keys(a));
+}
+
+// Небольшое множество против большого: путь с поиском в дереве
+TEST(SetTest, SetAlgebraSkewedSizes) {
+  s21::Set<int> large;
+  for (int k = 0; k < 10000; k += 2) large.insert(k);
+  s21::Set<int> small = {-1, 0, 7, 500, 9998, 10001};
+  EXPECT_EQ(Keys(small.set_intersection(large)),
+            (std::vector<int>{0, 500, 9998}));
+  EXPECT_EQ(Keys(large.set_intersection(small)),
+            (std::vector<int>{0, 500, 9998}));
+  EXPECT_EQ(Keys(small.set_difference(large)),
+            (std::vector<int>{-1, 7, 10001}));
+  EXPECT_EQ(large.set_difference(small).size(), 4997);
+  EXPECT_EQ(large.set_union(small).size(), 5003);
+}
+
+TEST(SetTest, SetAlgebraStrings) {
+  s21::Set<std::string> a = {"apple", "kiwi", "pear"};
+  s21::Set<std::string> b = {"kiwi", "lime"};
+  s21::Set<std::string> u = a.set_union(b);
+  std::vector<std::string> keys;
+  for (auto it = u.begin(); it != u.end(); ++it) keys.push_back(it->first);
+  EXPECT_EQ(keys, (std::vector<std::string>{"apple", "kiwi", "lime", "pear"}));
+  EXPECT_TRUE(a.set_intersection(b).contains("kiwi"));
+  EXPECT_EQ(a.set_symmetric_difference(b).size(), 3);
+}
+
+TEST(SetTest, InitializerListSortsAndDedupes) {
+  s21::Set<int> set = {5, 3, 9, 3, 1, 5, 7, 1};
+  EXPECT_EQ(set.size(), 5);
+  EXPECT_EQ(Keys(set), (std::vector<int>{1, 3, 5, 7, 9}));
+  set.insert(4);
+  set.erase(set.find(1));
+  EXPECT_FALSE(set.insert(9).second);
+  EXPECT_EQ(Keys(set), (std::vector<int>{3, 4, 5, 7, 9}));
+  // Из равных ключей остается первый, как при поочередной вставке
+  s21::Set<double> zeros = {0.0, -0.0};
+  ASSERT_EQ(zeros.size(), 1);
+  EXPECT_FALSE(std::signbit(zeros.begin()->first));
+  s21::Set<std::string> words = {"pear", "apple", "pear"};
+  EXPECT_EQ(words.size(), 2);
+  EXPECT_EQ(words.begin()->first, "apple");
+}
@@ -0,0 +1,172 @@
+#include "../s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Allocator that counts the buffers it hands out
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static int allocations;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* ptr, std::size_t n) {
+    std::allocator<T>().deallocate(ptr, n);
+  }
+  bool operator==(const CountingAllocator&) const { return true; }
+  bool operator!=(const CountingAllocator&) const { return false; }
+};
+template <typename T>
+int CountingAllocator<T>::allocations = 0;
+
+TEST(SmallVectorTest, StaysInlineUntilFull) {
+  CountingAllocator<int>::allocations = 0;
+  s21::SmallVector<int, 4, CountingAllocator<int>> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 4);
+  for (int i = 0; i < 4; ++i) vec.push_back(i);
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+  vec.push_back(4);
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  EXPECT_EQ(vec.capacity(), 8);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(vec[i], i);
+  EXPECT_EQ(*(vec.end() - 1), 4);
+}
+
+TEST(SmallVectorTest, Constructors) {
+  s21::SmallVector<int, 3> sized(2);
+  EXPECT_EQ(sized.size(), 2);
+  EXPECT_EQ(sized[1], 0);
+  s21::SmallVector<int, 3> list = {1, 2, 3, 4, 5};
+  EXPECT_FALSE(list.is_inline());
+  EXPECT_EQ(list.size(), 5);
+  EXPECT_EQ(list.at(4), 5);
+  EXPECT_THROW(list.at(5), std::out_of_range);
+  s21::SmallVector<int, 3> copy(list);
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(copy.back(), 5);
+  copy = s21::SmallVector<int, 3>{7};
+  EXPECT_EQ(copy.size(), 1);
+  EXPECT_EQ(copy.front(), 7);
+  EXPECT_TRUE(copy.is_inline());
+}
+
+TEST(SmallVectorTest, MoveInlineAndHeap) {
+  s21::SmallVector<std::string, 2> small = {std::string(40, 'a')};
+  s21::SmallVector<std::string, 2> moved(std::move(small));
+  EXPECT_TRUE(small.empty());
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0], std::string(40, 'a'));
+
+  s21::SmallVector<std::string, 2> big = {"x", "y", "z"};
+  const std::string* buffer = big.data();
+  s21::SmallVector<std::string, 2> stolen(std::move(big));
+  EXPECT_EQ(stolen.data(), buffer);
+  EXPECT_TRUE(big.empty());
+  EXPECT_TRUE(big.is_inline());
+  big.push_back("again");
+  EXPECT_EQ(big[0], "again");
+
+  moved = std::move(stolen);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(moved[2], "z");
+  EXPECT_TRUE(stolen.empty());
+}
+
+TEST(SmallVectorTest, InsertEraseShrink) {
+  s21::SmallVector<std::string, 4> vec;
+  for (int i = 0; i < 10; ++i) vec.push_back(std::to_string(i));
+  vec.insert(vec.begin() + 5, "middle");
+  vec.insert(vec.begin(), vec[3]);
+  EXPECT_EQ(vec.size(), 12);
+  EXPECT_EQ(vec[0], "3");
+  EXPECT_EQ(vec[6], "middle");
+  for (int i = 0; i < 9; ++i) vec.erase(vec.begin());
+  vec.pop_back();
+  EXPECT_EQ(vec.size(), 2);
+  vec.shrink_to_fit();
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ(vec.capacity(), 4);
+  EXPECT_EQ(vec[0], "7");
+  EXPECT_EQ(vec[1], "8");
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(SmallVectorTest, SwapMixedStorage) {
+  s21::SmallVector<std::string, 2> inline_vec = {"a"};
+  s21::SmallVector<std::string, 2> heap_vec = {"b", "c", "d"};
+  inline_vec.swap(heap_vec);
+  EXPECT_EQ(inline_vec.size(), 3);
+  EXPECT_EQ(inline_vec[2], "d");
+  EXPECT_FALSE(inline_vec.is_inline());
+  EXPECT_EQ(heap_vec.size(), 1);
+  EXPECT_EQ(heap_vec[0], "a");
+  EXPECT_TRUE(heap_vec.is_inline());
+  s21::SmallVector<std::string, 2> other = {"e", "f", "g", "h"};
+  inline_vec.swap(other);
+  EXPECT_EQ(inline_vec.size(), 4);
+  EXPECT_EQ(other[0], "b");
+}
+
+TEST(SmallVectorTest, PmrSpillsToResource) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::pmr::SmallVector<int, 2> vec(&resource);
+  vec.push_back(1);
+  vec.push_back(2);
+  EXPECT_TRUE(vec.is_inline());
+  vec.push_back(3);
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(vec.get_allocator().resource(), &resource);
+  EXPECT_EQ(vec[2], 3);
+}
+
+namespace {
+
+// Counts live objects; move assignment throws while fail is set
+struct AssignThrows {
+  static inline int alive = 0;
+  static inline bool fail = false;
+  int value;
+  explicit AssignThrows(int v) : value(v) { ++alive; }
+  AssignThrows(const AssignThrows& other) : value(other.value) {
+    ++alive;
+  }
+  AssignThrows& operator=(AssignThrows&& other) {
+    if (fail) throw std::runtime_error("assign");
+    value = other.value;
+    return *this;
+  }
+  ~AssignThrows() { --alive; }
+};
+
+}  // namespace
+
+// The element built past the end before the shift must not leak
+TEST(SmallVectorTest, ThrowingShiftKeepsTailOwned) {
+  {
+    s21::SmallVector<AssignThrows, 8> vec;
+    vec.reserve(8);
+    for (int i = 0; i < 4; ++i) vec.push_back(AssignThrows(i));
+    AssignThrows::fail = true;
+    EXPECT_THROW(vec.insert(vec.begin(), AssignThrows(9)),
+                 std::runtime_error);
+    AssignThrows::fail = false;
+    EXPECT_EQ(vec.size(), 5);
+    EXPECT_EQ(AssignThrows::alive, 5);
+  }
+  EXPECT_EQ(AssignThrows::alive, 0);
+}
@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <utility>
+
+#include "../s21_deque.h"
+
 TEST(StackTest, Constructors) {
   size_t count = 5;
   s21::Stack<int> s1, s2{0, 1, 2, 3, 4, 5}, s3(s2);
@@ -72,3 +77,62 @@ TEST(StackTest, StackModifiers) {
     count--;
   }
 }
+
+template <class StackType>
+void CheckLifo() {
+  StackType s{1, 2, 3};
+  for (int i = 4; i <= 1000; ++i) s.push(i);
+  StackType copy(s);
+  for (int i = 1000; i > 0; --i) {
+    ASSERT_EQ(s.top(), i);
+    s.pop();
+  }
+  ASSERT_TRUE(s.empty());
+  ASSERT_EQ(copy.size(), 1000);
+  ASSERT_EQ(copy.top(), 1000);
+}
+
+TEST(StackTest, Containers) {
+  CheckLifo<s21::Stack<int>>();
+  CheckLifo<s21::Stack<int, s21::List<int>>>();
+  CheckLifo<s21::Stack<int, s21::Deque<int>>>();
+}
+
+template <class StackType>
+void CheckStackEmplace() {
+  StackType s;
+  s.emplace(3, 'a');
+  std::string long_string(40, 'b');
+  s.push(std::move(long_string));
+  s.insert_many_back("c", std::string("d"));
+  ASSERT_EQ(s.size(), 4);
+  ASSERT_EQ(s.top(), "d");
+  s.pop();
+  ASSERT_EQ(s.top(), "c");
+  s.pop();
+  ASSERT_EQ(s.top(), std::string(40, 'b'));
+  s.pop();
+  ASSERT_EQ(s.top(), "aaa");
+}
+
+TEST(StackTest, EmplaceAndMove) {
+  CheckStackEmplace<s21::Stack<std::string>>();
+  CheckStackEmplace<s21::Stack<std::string, s21::List<std::string>>>();
+  CheckStackEmplace<s21::Stack<std::string, s21::Deque<std::string>>>();
+}
+
+template <class StackType>
+void CheckEmptyThrows() {
+  StackType s;
+  ASSERT_THROW(s.top(), std::runtime_error);
+  ASSERT_THROW(s.pop(), std::runtime_error);
+  s.push(1);
+  s.pop();
+  ASSERT_THROW(s.top(), std::runtime_error);
+}
+
+TEST(StackTest, EmptyThrows) {
+  CheckEmptyThrows<s21::Stack<int>>();
+  CheckEmptyThrows<s21::Stack<int, s21::List<int>>>();
+  CheckEmptyThrows<s21::Stack<int, s21::Deque<int>>>();
+}
@@ -0,0 +1,106 @@
+#include "../s21_thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_vector.h"
+
+namespace {
+
+long long SumRange(s21::ThreadPool& pool, const s21::Vector<int>& data,
+                   std::size_t first, std::size_t last) {
+  if (last - first <= 1000) {
+    long long sum = 0;
+    for (std::size_t i = first; i < last; ++i) sum += data[i];
+    return sum;
+  }
+  const std::size_t middle = first + (last - first) / 2;
+  long long left = 0;
+  s21::TaskGroup group(pool);
+  group.run([&] { left = SumRange(pool, data, first, middle); });
+  const long long right = SumRange(pool, data, middle, last);
+  group.wait();
+  return left + right;
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, SubmitReturnsResults) {
+  s21::ThreadPool pool(3);
+  ASSERT_EQ(pool.size(), 3);
+  ASSERT_EQ(pool.current_worker(), 3);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.submit([i] { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) ASSERT_EQ(results[i].get(), i * i);
+  auto worker = pool.submit([&pool] { return pool.current_worker(); });
+  ASSERT_LT(worker.get(), 3);
+  auto failing = pool.submit([]() -> std::string {
+    throw std::runtime_error("task failed");
+  });
+  ASSERT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks) {
+  std::atomic<int> runs{0};
+  {
+    s21::ThreadPool pool(2);
+    for (int i = 0; i < 1000; ++i) pool.post([&runs] { ++runs; });
+  }
+  ASSERT_EQ(runs.load(), 1000);
+}
+
+TEST(ThreadPoolTest, RecursiveForkJoin) {
+  s21::ThreadPool pool(4);
+  s21::Vector<int> data(200000);
+  long long expected = 0;
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int>(i % 1000);
+    expected += data[i];
+  }
+  ASSERT_EQ(SumRange(pool, data, 0, data.size()), expected);
+}
+
+TEST(ThreadPoolTest, TasksSpreadAcrossWorkers) {
+  s21::ThreadPool pool(4);
+  std::mutex mutex;
+  std::set<std::size_t> workers;
+  s21::TaskGroup group(pool);
+  for (int i = 0; i < 64; ++i) {
+    group.run([&] {
+      // Long enough that idle workers steal the rest
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      std::lock_guard<std::mutex> lock(mutex);
+      workers.insert(pool.current_worker());
+    });
+  }
+  group.wait();
+  ASSERT_GT(workers.size(), 1);
+}
+
+TEST(ThreadPoolTest, TaskGroupRethrowsFirstError) {
+  s21::ThreadPool pool(2);
+  std::atomic<int> runs{0};
+  s21::TaskGroup group(pool);
+  for (int i = 0; i < 10; ++i) {
+    group.run([&runs, i] {
+      ++runs;
+      if (i == 5) throw std::invalid_argument("bad item");
+    });
+  }
+  ASSERT_THROW(group.wait(), std::invalid_argument);
+  ASSERT_EQ(runs.load(), 10);
+  group.run([&runs] { ++runs; });
+  ASSERT_NO_THROW(group.wait());
+  ASSERT_EQ(runs.load(), 11);
+}
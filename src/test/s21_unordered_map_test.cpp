@@ -0,0 +1,216 @@
+#include "../s21_unordered_map.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Value whose copy and move both throw on the third call once armed
+struct ThrowingValue {
+  static inline int countdown = -1;
+
+  explicit ThrowingValue(int v) : value(v) {}
+  ThrowingValue(const ThrowingValue& other) : value(other.value) { tick(); }
+  ThrowingValue(ThrowingValue&& other) : value(other.value) { tick(); }
+  ThrowingValue& operator=(const ThrowingValue&) = default;
+
+  static void tick() {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("move");
+  }
+
+  int value;
+};
+
+}  // namespace
+
+TEST(UnorderedMapTest, Constructors) {
+  s21::UnorderedMap<int, std::string> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.bucket_count(), 0);
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::UnorderedMap<int, std::string> map{{1, "one"}, {2, "two"}, {1, "x"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), "one");
+
+  s21::UnorderedMap<int, std::string> copy(map);
+  EXPECT_EQ(copy.at(2), "two");
+  s21::UnorderedMap<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 2);
+
+  empty = moved;
+  EXPECT_EQ(empty.at(1), "one");
+  empty = std::move(moved);
+  EXPECT_EQ(empty.size(), 2);
+}
+
+TEST(UnorderedMapTest, Access) {
+  s21::UnorderedMap<std::string, int> map;
+  map["a"] = 1;
+  map["b"] += 2;
+  EXPECT_EQ(map["a"], 1);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+  const auto& cmap = map;
+  EXPECT_EQ(cmap.at("a"), 1);
+  EXPECT_EQ(cmap.find("a")->second, 1);
+  EXPECT_EQ(cmap.find("c"), cmap.end());
+}
+
+TEST(UnorderedMapTest, Insert) {
+  s21::UnorderedMap<int, int> map;
+  EXPECT_TRUE(map.insert({1, 10}).second);
+  EXPECT_FALSE(map.insert(1, 20).second);
+  EXPECT_EQ(map.at(1), 10);
+  auto result = map.insert_or_assign(1, 30);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, 30);
+  EXPECT_TRUE(map.insert_or_assign(2, 40).second);
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST(UnorderedMapTest, Erase) {
+  s21::UnorderedMap<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+  map.erase(map.find(2));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  EXPECT_EQ(map.size(), 1);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(UnorderedMapTest, Iterate) {
+  s21::UnorderedMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) map.insert(i, i * i);
+  long long sum = 0;
+  std::size_t count = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(it->second, it->first * it->first);
+    sum += it->first;
+    ++count;
+  }
+  EXPECT_EQ(count, 1000);
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+TEST(UnorderedMapTest, SwapMerge) {
+  s21::UnorderedMap<int, std::string> a{{1, "a1"}, {2, "a2"}};
+  s21::UnorderedMap<int, std::string> b{{2, "b2"}, {3, "b3"}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(a.at(2), "a2");
+  EXPECT_EQ(a.at(3), "b3");
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(b.at(2), "b2");
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1);
+  EXPECT_EQ(b.size(), 3);
+}
+
+TEST(UnorderedMapTest, Reserve) {
+  s21::UnorderedMap<int, int> map;
+  map.reserve(1000);
+  const auto buckets = map.bucket_count();
+  EXPECT_GE(buckets, 1000);
+  for (int i = 0; i < 1000; ++i) map[i] = i;
+  EXPECT_EQ(map.bucket_count(), buckets);
+}
+
+// Erase/insert churn on a fixed key range must not grow the table:
+// tombstones are purged in place instead
+TEST(UnorderedMapTest, TombstoneChurn) {
+  s21::UnorderedMap<int, int> map;
+  for (int i = 0; i < 60; ++i) map[i] = i;
+  const auto buckets = map.bucket_count();
+  for (int round = 0; round < 10000; ++round) {
+    const int temporary = 60 + round;
+    map[temporary] = round;
+    map.erase(temporary);
+  }
+  EXPECT_EQ(map.size(), 60);
+  EXPECT_EQ(map.bucket_count(), buckets);
+  for (int i = 0; i < 60; ++i) EXPECT_EQ(map.at(i), i);
+}
+
+// Values that move without throwing but not with memcpy go through the
+// same in-place purge
+TEST(UnorderedMapTest, TombstoneChurnStrings) {
+  s21::UnorderedMap<int, std::string> map;
+  for (int i = 0; i < 100; ++i) map[i] = std::string(20, 'a' + i % 26);
+  const auto buckets = map.bucket_count();
+  for (int round = 0; round < 5000; ++round) {
+    map.insert(1000 + round, std::to_string(round));
+    map.erase(1000 + round);
+  }
+  EXPECT_EQ(map.bucket_count(), buckets);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.at(i), std::string(20, 'a' + i % 26));
+  }
+}
+
+// The new value is copied from an element while the table may rehash
+TEST(UnorderedMapTest, InsertFromOwnElement) {
+  s21::UnorderedMap<int, std::vector<int>> map;
+  map.insert(0, std::vector<int>(10, 7));
+  for (int i = 1; i < 200; ++i) {
+    map.insert(i, map.at(i - 1));
+    map.insert_or_assign(i, map.at(0));
+  }
+  EXPECT_EQ(map.size(), 200);
+  for (int i = 0; i < 200; ++i) EXPECT_EQ(map.at(i), std::vector<int>(10, 7));
+}
+
+// A throw while the table grows leaves every value in the old arrays
+TEST(UnorderedMapTest, ThrowingMoveDuringResize) {
+  s21::UnorderedMap<int, ThrowingValue> map;
+  map.reserve(100);
+  const auto full_buckets = map.bucket_count();
+  const int count = static_cast<int>(full_buckets - full_buckets / 8);
+  for (int i = 0; i < count; ++i) map.insert(i, ThrowingValue(i));
+  ASSERT_EQ(map.bucket_count(), full_buckets);
+  ThrowingValue::countdown = 3;
+  EXPECT_THROW(map.insert(count, ThrowingValue(count)), std::runtime_error);
+  ThrowingValue::countdown = -1;
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(count));
+  EXPECT_EQ(map.bucket_count(), full_buckets);
+  for (int i = 0; i < count; ++i) ASSERT_EQ(map.at(i).value, i);
+  map.insert(count, ThrowingValue(count));
+  EXPECT_GT(map.bucket_count(), full_buckets);
+  EXPECT_EQ(map.at(count).value, count);
+}
+
+TEST(UnorderedMapTest, RandomOperations) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> key_dist(0, 5000);
+  s21::UnorderedMap<int, int> map;
+  std::unordered_map<int, int> expected;
+  for (int i = 0; i < 200000; ++i) {
+    int key = key_dist(gen);
+    switch (gen() % 4) {
+      case 0:
+      case 1:
+        ASSERT_EQ(map.insert(key, i).second, expected.insert({key, i}).second);
+        break;
+      case 2:
+        ASSERT_EQ(map.erase(key), expected.erase(key));
+        break;
+      default:
+        ASSERT_EQ(map.contains(key), expected.count(key) == 1);
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  for (const auto& item : expected) {
+    ASSERT_EQ(map.at(item.first), item.second);
+  }
+  std::size_t count = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) ++count;
+  EXPECT_EQ(count, expected.size());
+}
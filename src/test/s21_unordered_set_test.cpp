@@ -0,0 +1,59 @@
+#include "../s21_unordered_set.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+TEST(UnorderedSetTest, Constructors) {
+  s21::UnorderedSet<int> empty;
+  EXPECT_TRUE(empty.empty());
+  s21::UnorderedSet<int> set{1, 2, 3, 2};
+  EXPECT_EQ(set.size(), 3);
+  s21::UnorderedSet<int> copy(set);
+  EXPECT_TRUE(copy.contains(3));
+  s21::UnorderedSet<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 3);
+  empty = moved;
+  EXPECT_EQ(empty.size(), 3);
+}
+
+TEST(UnorderedSetTest, InsertEraseFind) {
+  s21::UnorderedSet<std::string> set;
+  EXPECT_TRUE(set.insert("a").second);
+  EXPECT_FALSE(set.insert("a").second);
+  EXPECT_TRUE(set.insert("b").second);
+  EXPECT_EQ(*set.find("a"), "a");
+  EXPECT_EQ(set.find("c"), set.end());
+  set.erase(set.find("a"));
+  EXPECT_FALSE(set.contains("a"));
+  EXPECT_EQ(set.erase("b"), 1);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(UnorderedSetTest, SwapMerge) {
+  s21::UnorderedSet<int> a{1, 2};
+  s21::UnorderedSet<int> b{2, 3};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_TRUE(b.contains(2));
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1);
+  EXPECT_EQ(b.size(), 3);
+}
+
+TEST(UnorderedSetTest, Large) {
+  s21::UnorderedSet<int> set;
+  std::unordered_set<int> expected;
+  for (int i = 0; i < 100000; ++i) {
+    int key = (i * 7919) % 50021;
+    EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    if (i % 3 == 0) {
+      EXPECT_EQ(set.erase(key / 2), expected.erase(key / 2));
+    }
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  for (int key : set) EXPECT_EQ(expected.count(key), 1);
+}
@@ -2,6 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 // Constructor tests
 TEST(VectorTest, DefaultConstructor) {
   s21::Vector<int> vec;
@@ -185,3 +192,248 @@ TEST(VectorTest, Swap) {
   EXPECT_EQ(vec2[0], 1);
   EXPECT_EQ(vec2[1], 2);
 }
+
+// Counts live objects to check that unused capacity is never constructed
+struct Tracked {
+  static int alive;
+  int value;
+  Tracked(int v = 0) : value(v) { ++alive; }
+  Tracked(const Tracked& other) : value(other.value) { ++alive; }
+  Tracked& operator=(const Tracked& other) = default;
+  ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+TEST(VectorTest, ReserveConstructsNothing) {
+  {
+    s21::Vector<Tracked> vec;
+    vec.reserve(1000);
+    EXPECT_EQ(Tracked::alive, 0);
+    for (int i = 0; i < 100; ++i) vec.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::alive, 100);
+    vec.erase(vec.begin());
+    vec.pop_back();
+    EXPECT_EQ(Tracked::alive, 98);
+    EXPECT_EQ(vec[0].value, 1);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(VectorTest, NonTrivialGrowth) {
+  s21::Vector<std::string> vec;
+  for (int i = 0; i < 100; ++i) vec.push_back(std::to_string(i));
+  vec.insert(vec.begin() + 50, "middle");
+  vec.insert(vec.begin(), vec[10]);
+  EXPECT_EQ(vec.size(), 102);
+  EXPECT_EQ(vec[0], "10");
+  EXPECT_EQ(vec[51], "middle");
+  EXPECT_EQ(vec.back(), "99");
+  vec.erase(vec.begin() + 51);
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.capacity(), 101);
+  EXPECT_EQ(vec[51], "50");
+  s21::Vector<std::string> copy;
+  copy = vec;
+  EXPECT_EQ(copy.size(), 101);
+  EXPECT_EQ(copy[100], "99");
+}
+
+TEST(VectorTest, InsertAliasedValue) {
+  s21::Vector<int> vec = {1, 2, 3};
+  vec.insert(vec.begin(), vec[2]);
+  vec.push_back(vec[0]);
+  EXPECT_EQ(vec.size(), 5);
+  EXPECT_EQ(vec[0], 3);
+  EXPECT_EQ(vec[1], 1);
+  EXPECT_EQ(vec[4], 3);
+}
+
+TEST(VectorTest, GrowthPolicies) {
+  s21::Vector<int> doubling;
+  s21::Vector<int, std::allocator<int>, s21::GrowOneAndHalf> half;
+  s21::Vector<int, std::allocator<int>, s21::GrowSizeClass> size_class;
+  for (int i = 0; i < 10; ++i) {
+    doubling.push_back(i);
+    half.push_back(i);
+    size_class.push_back(i);
+  }
+  EXPECT_EQ(doubling.capacity(), 16);
+  // 1, 2, 3, 4, 6, 9, 13
+  EXPECT_EQ(half.capacity(), 13);
+  // 4 ints fill the smallest 16-byte class, then 32 and 48 bytes
+  EXPECT_EQ(size_class.capacity(), 12);
+  EXPECT_EQ(half[9], 9);
+  EXPECT_EQ(size_class[9], 9);
+  EXPECT_EQ(s21::GrowSizeClass::round_to_class(129), 160);
+  EXPECT_EQ(s21::GrowSizeClass::round_to_class(4097), 5120);
+  EXPECT_EQ(s21::GrowSizeClass::next_capacity(1000, 1), 1536);
+}
+
+TEST(VectorTest, InsertRange) {
+  s21::Vector<int> vec = {1, 2, 6};
+  const int middle[] = {3, 4, 5};
+  auto it = vec.insert(vec.begin() + 2, std::begin(middle), std::end(middle));
+  EXPECT_EQ(it, vec.begin() + 2);
+  EXPECT_EQ(vec.size(), 6);
+  for (int i = 0; i < 6; ++i) EXPECT_EQ(vec[i], i + 1);
+  vec.reserve(20);
+  std::list<int> front = {-1, 0};
+  vec.insert(vec.begin(), front.begin(), front.end());
+  EXPECT_EQ(vec.capacity(), 20);
+  EXPECT_EQ(vec[0], -1);
+  EXPECT_EQ(vec[7], 6);
+  std::istringstream input("7 8 9");
+  vec.insert(vec.begin() + 1, std::istream_iterator<int>(input),
+             std::istream_iterator<int>());
+  EXPECT_EQ(vec.size(), 11);
+  EXPECT_EQ(vec[1], 7);
+  EXPECT_EQ(vec[3], 9);
+  EXPECT_EQ(vec[4], 0);
+  vec.insert(vec.end(), front.begin(), front.begin());
+  EXPECT_EQ(vec.size(), 11);
+}
+
+TEST(VectorTest, InsertCountAndAppend) {
+  s21::Vector<int> vec = {1, 2};
+  vec.insert(vec.begin() + 1, 3, vec[1]);
+  EXPECT_EQ(vec.size(), 5);
+  EXPECT_EQ(vec[1], 2);
+  EXPECT_EQ(vec[3], 2);
+  EXPECT_EQ(vec[4], 2);
+  std::vector<int> more = {7, 8};
+  vec.append_range(more);
+  EXPECT_EQ(vec.size(), 7);
+  EXPECT_EQ(vec[6], 8);
+}
+
+// Both in-place paths for non-trivial elements: the new range shorter and
+// longer than the tail it moves past, plus the reallocating path
+TEST(VectorTest, InsertRangeNonTrivial) {
+  s21::Vector<std::string> vec = {"a", "b", "c", "d"};
+  vec.reserve(16);
+  std::vector<std::string> one = {"x"};
+  vec.insert(vec.begin() + 1, one.begin(), one.end());
+  std::vector<std::string> many = {"p", "q", "r", "s"};
+  vec.insert(vec.begin() + 4, many.begin(), many.end());
+  std::vector<std::string> expected = {"a", "x", "b", "c", "p",
+                                       "q", "r", "s", "d"};
+  ASSERT_EQ(vec.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(vec[i], expected[i]);
+  }
+  vec.insert(vec.begin(), 10, std::string(30, 'z'));
+  EXPECT_EQ(vec.size(), 19);
+  EXPECT_EQ(vec[9], std::string(30, 'z'));
+  EXPECT_EQ(vec[10], "a");
+  EXPECT_EQ(vec.back(), "d");
+}
+
+TEST(VectorTest, EraseRangeAndEraseIf) {
+  {
+    s21::Vector<Tracked> vec;
+    for (int i = 0; i < 10; ++i) vec.push_back(Tracked(i));
+    auto it = vec.erase(vec.begin() + 2, vec.begin() + 5);
+    EXPECT_EQ(it->value, 5);
+    EXPECT_EQ(vec.size(), 7);
+    EXPECT_EQ(Tracked::alive, 7);
+    EXPECT_EQ(vec.erase(vec.end(), vec.end()), vec.end());
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+  s21::Vector<int> numbers;
+  for (int i = 0; i < 100; ++i) numbers.push_back(i);
+  EXPECT_EQ(s21::erase_if(numbers, [](int n) { return n % 3 != 0; }), 66);
+  EXPECT_EQ(numbers.size(), 34);
+  EXPECT_EQ(numbers[33], 99);
+  s21::Vector<std::string> words = {"keep", "drop", "keep", "drop"};
+  EXPECT_EQ(s21::erase_if(words, [](const std::string& w) {
+              return w == "drop";
+            }),
+            2);
+  EXPECT_EQ(words.size(), 2);
+  EXPECT_EQ(words[1], "keep");
+}
+
+TEST(VectorTest, EmplaceAndMove) {
+  s21::Vector<std::string> vec;
+  EXPECT_EQ(vec.emplace_back(3, 'x'), "xxx");
+  std::string long_string(40, 'm');
+  const char* buffer = long_string.data();
+  vec.push_back(std::move(long_string));
+  EXPECT_EQ(vec[1].data(), buffer);
+  auto it = vec.emplace(vec.begin(), "front");
+  EXPECT_EQ(*it, "front");
+  std::string middle(50, 'i');
+  buffer = middle.data();
+  vec.insert(vec.begin() + 1, std::move(middle));
+  EXPECT_EQ(vec[1].data(), buffer);
+  EXPECT_EQ(vec.size(), 4);
+  EXPECT_EQ(vec[2], "xxx");
+  EXPECT_EQ(vec[3], std::string(40, 'm'));
+}
+
+TEST(VectorTest, EmplaceAliasing) {
+  s21::Vector<std::string> vec = {std::string(30, 'a'), "b"};
+  ASSERT_EQ(vec.size(), vec.capacity());
+  vec.emplace_back(vec[0]);
+  EXPECT_EQ(vec[2], std::string(30, 'a'));
+  vec.shrink_to_fit();
+  vec.emplace(vec.begin(), vec.back());
+  EXPECT_EQ(vec[0], std::string(30, 'a'));
+  EXPECT_EQ(vec[3], std::string(30, 'a'));
+  vec.emplace(vec.begin() + 2, vec[1]);
+  EXPECT_EQ(vec[2], std::string(30, 'a'));
+  EXPECT_EQ(vec[3], "b");
+}
+
+TEST(VectorTest, InsertMany) {
+  s21::Vector<int> vec = {1, 5};
+  auto it = vec.insert_many(vec.begin() + 1, 2, 3, 4);
+  EXPECT_EQ(*it, 2);
+  vec.insert_many_back(6, 7);
+  vec.insert_many(vec.begin(), 0);
+  ASSERT_EQ(vec.size(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(vec[i], i);
+  s21::Vector<std::string> words = {"c"};
+  words.insert_many(words.begin(), std::string("a"), "b");
+  words.insert_many_back("d", std::string(2, 'd'));
+  EXPECT_EQ(words[0], "a");
+  EXPECT_EQ(words[1], "b");
+  EXPECT_EQ(words[4], "dd");
+}
+
+namespace {
+
+// Counts live objects; move assignment throws while fail is set
+struct AssignThrows {
+  static inline int alive = 0;
+  static inline bool fail = false;
+  int value;
+  explicit AssignThrows(int v) : value(v) { ++alive; }
+  AssignThrows(const AssignThrows& other) : value(other.value) {
+    ++alive;
+  }
+  AssignThrows& operator=(AssignThrows&& other) {
+    if (fail) throw std::runtime_error("assign");
+    value = other.value;
+    return *this;
+  }
+  ~AssignThrows() { --alive; }
+};
+
+}  // namespace
+
+// The element built past the end before the shift must not leak
+TEST(VectorTest, ThrowingShiftKeepsTailOwned) {
+  {
+    s21::Vector<AssignThrows> vec;
+    vec.reserve(8);
+    for (int i = 0; i < 4; ++i) vec.push_back(AssignThrows(i));
+    AssignThrows::fail = true;
+    EXPECT_THROW(vec.insert(vec.begin(), AssignThrows(9)),
+                 std::runtime_error);
+    AssignThrows::fail = false;
+    EXPECT_EQ(vec.size(), 5);
+    EXPECT_EQ(AssignThrows::alive, 5);
+  }
+  EXPECT_EQ(AssignThrows::alive, 0);
+}
@@ -0,0 +1,80 @@
+#include "../s21_work_stealing_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WorkStealingDequeTest, OwnerIsLifoThiefIsFifo) {
+  s21::WorkStealingDeque<int> d(4);
+  int value = 0;
+  ASSERT_FALSE(d.pop(value));
+  ASSERT_FALSE(d.steal(value));
+  for (int i = 0; i < 4; ++i) d.push(i);
+  ASSERT_EQ(d.size(), 4);
+  ASSERT_TRUE(d.pop(value));
+  ASSERT_EQ(value, 3);
+  ASSERT_TRUE(d.steal(value));
+  ASSERT_EQ(value, 0);
+  ASSERT_TRUE(d.steal(value));
+  ASSERT_EQ(value, 1);
+  ASSERT_TRUE(d.pop(value));
+  ASSERT_EQ(value, 2);
+  ASSERT_TRUE(d.empty());
+  ASSERT_FALSE(d.pop(value));
+}
+
+TEST(WorkStealingDequeTest, GrowsAndKeepsOrder) {
+  s21::WorkStealingDeque<int> d(2);
+  int value = 0;
+  for (int i = 0; i < 10; ++i) d.push(i);
+  ASSERT_TRUE(d.steal(value));
+  ASSERT_EQ(value, 0);
+  // Wraps the grown ring and grows again with a nonzero top
+  for (int i = 10; i < 40; ++i) d.push(i);
+  ASSERT_GE(d.capacity(), 39);
+  ASSERT_EQ(d.size(), 39);
+  for (int i = 1; i < 20; ++i) {
+    ASSERT_TRUE(d.steal(value));
+    ASSERT_EQ(value, i);
+  }
+  for (int i = 39; i >= 20; --i) {
+    ASSERT_TRUE(d.pop(value));
+    ASSERT_EQ(value, i);
+  }
+  ASSERT_FALSE(d.steal(value));
+}
+
+// The owner pushes and pops while thieves steal; every element must be
+// taken exactly once
+TEST(WorkStealingDequeTest, ConcurrentThieves) {
+  constexpr int kCount = 100000;
+  constexpr int kThieves = 3;
+  s21::WorkStealingDeque<int> d(8);
+  std::vector<std::atomic<int>> taken(kCount);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int value;
+      while (!done.load()) {
+        if (d.steal(value)) {
+          ++taken[value];
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < kCount; ++i) {
+    d.push(i);
+    if (i % 3 == 0 && d.pop(value)) ++taken[value];
+  }
+  while (d.pop(value)) ++taken[value];
+  done.store(true);
+  for (auto& thief : thieves) thief.join();
+  while (d.steal(value)) ++taken[value];
+  for (const auto& count : taken) ASSERT_EQ(count.load(), 1);
+}